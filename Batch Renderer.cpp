@@ -0,0 +1,1736 @@
+#include "Bezier Spline.h"
+#include "Binary Tree.h"
+#include "Bresenham Line.h"
+#include "Circle.h"
+#include "Command Buffer.h"
+#include "DDA Line.h"
+#include "Ellipse.h"
+#include "Filled Shapes.h"
+#include "Iterated Function System.h"
+#include "Koch Curve.h"
+#include "Mandelbrot.h"
+#include "Sierpinski Gasket.h"
+#include "Wu Line.h"
+
+#include <chrono>
+#include <climits>
+#include <sstream>
+
+enum class ALGORITHM
+{
+    DDA_LINE          = 0,
+    BRESENHAM_LINE    = 1,
+    CIRCLE            = 2,
+    ELLIPSE           = 3,
+    KOCH_CURVE        = 4,
+    NORMAL_TREE       = 5,
+    RANDOM_TREE       = 6,
+    SIERPINSKI_GASKET = 7,
+    BEZIER_SPLINE     = 8,
+    MANDELBROT        = 9,
+    IFS               = 10,
+    WU_LINE           = 11,
+    FILLED_SHAPES     = 12
+};
+
+struct RenderJob
+{
+    ALGORITHM                  algorithm;
+    PixelSize                  imageSize;
+    std::string                outputPath;
+    int                        steps;
+    uint64_t                   seed;
+    bool                       isDensity;
+    LINEMODE                   lineMode;
+    std::vector<PixelPoint>    points;
+    SPLINE                     spline;
+    double                     flatness;
+    std::tuple<double, double> center;
+    std::tuple<double, double> viewport;
+    IteratedFunctionSystem     system;
+};
+
+// Every worker keeps its buffers between jobs, so a run of same-sized jobs allocates only once per worker.
+struct RenderBuffer
+{
+    Framebuffer<RGB8> colorImage;
+    std::vector<int>  iterationImage;
+};
+
+// Scene coordinates are written for the 500x500 images in Output/ and scaled to the requested resolution.
+static const PixelSize REFERENCE_SIZE = { 500, 500 };
+
+// Colour jobs from this many pixels up are drawn straight into a mapped output file instead of a buffer that is then copied out.
+static const size_t MAPPED_PIXEL_COUNT = 4096 * 4096;
+
+static const PixelSize BENCHMARK_SIZE            = { 1920, 1080 };
+static const int       BENCHMARK_PRIMITIVE_COUNT = 20000;
+static const long long BENCHMARK_CHAOS_STEPS     = 100000000;
+static const int       BENCHMARK_CURVE_COUNT     = 2000;
+static const int       BENCHMARK_BATCH_COUNT     = 20000;
+static const int       BENCHMARK_SHAPE_COUNT     = 10000;
+static const int       BENCHMARK_OUTLINE_COUNT   = 2000;
+static const int       BENCHMARK_WIREFRAME_COUNT = 200000;
+static const int       BENCHMARK_DDA_COUNT       = 200000;
+static const PixelSize BENCHMARK_COMMAND_SIZE    = { 4096, 4096 };
+static const int       BENCHMARK_COMMAND_COUNT   = 40000;
+
+static const int         ALGORITHM_COUNT          = 13;
+static const char* const ALGORITHM_NAMES[13]      = { "dda", "bresenham", "circle", "ellipse", "koch", "normal-tree", "random-tree", "gasket", "bezier", "mandelbrot", "ifs", "wu", "filled" };
+static const char* const GALLERY_FILE_NAMES[13]   = { "DDA Line.ppm", "Bresenham Line.ppm", "Circle.ppm", "Ellipse.ppm", "Koch Curve.ppm", "Normal Binary Tree.ppm", "Random Binary Tree.ppm", "Sierpinski Gasket.ppm", "Bezier Spline.ppm", "Mandelbrot.pgm", "Barnsley Fern.ppm", "Wu Line.ppm", "Filled Shapes.ppm" };
+static const int         DEFAULT_STEPS[13]        = { 0, 0, 0, 0, 3, 10, 10, 100000, 1000, 0, 10000000, 0, 0 };
+static const char* const IFS_SYSTEM_NAMES[3]      = { "fern", "carpet", "triangle" };
+static const char* const SPLINE_NAMES[3]          = { "bezier", "bspline", "catmull-rom" };
+static const char* const LINE_MODE_NAMES[2]       = { "aliased", "antialiased" };
+static const PixelPoint  DEFAULT_BEZIER_POINTS[4] = { { 50, 450 }, { 150, 50 }, { 350, 50 }, { 450, 450 } };
+static const uint64_t    DEFAULT_SEED             = 2024;
+
+PixelPoint ScalePoint(PixelPoint point, PixelSize imageSize)
+{
+    return { (coord_t)(point.x * imageSize.cx / (double)REFERENCE_SIZE.cx + 0.5), (coord_t)(point.y * imageSize.cy / (double)REFERENCE_SIZE.cy + 0.5) };
+}
+
+PixelSize ScaleSize(PixelSize size, PixelSize imageSize)
+{
+    return { (coord_t)(size.cx * imageSize.cx / (double)REFERENCE_SIZE.cx + 0.5), (coord_t)(size.cy * imageSize.cy / (double)REFERENCE_SIZE.cy + 0.5) };
+}
+
+coord_t ScaleLength(coord_t length, PixelSize imageSize)
+{
+    return (coord_t)(length * std::min(imageSize.cx / (double)REFERENCE_SIZE.cx, imageSize.cy / (double)REFERENCE_SIZE.cy) + 0.5);
+}
+
+RenderJob CreateDefaultJob(ALGORITHM algorithm, PixelSize imageSize, std::string outputPath)
+{
+    RenderJob job;
+
+    job.algorithm  = algorithm;
+    job.imageSize  = imageSize;
+    job.outputPath = outputPath;
+    job.steps      = DEFAULT_STEPS[(int)algorithm];
+    job.seed       = DEFAULT_SEED;
+    job.isDensity  = false;
+    job.lineMode   = LINEMODE::ALIASED;
+    job.spline     = SPLINE::BEZIER;
+    job.flatness   = 0.0;
+    job.center     = std::make_tuple(-0.5, 0.0);
+    job.viewport   = std::make_tuple(2.0, 2.0);
+
+    job.system     = CreateBarnsleyFern();
+
+    if (algorithm == ALGORITHM::BEZIER_SPLINE)
+        job.points.assign(DEFAULT_BEZIER_POINTS, DEFAULT_BEZIER_POINTS + 4);
+
+    return job;
+}
+
+bool ParseAlgorithm(const std::string& name, ALGORITHM& algorithm)
+{
+    for (int index = 0; index < ALGORITHM_COUNT; ++index)
+        if (name == ALGORITHM_NAMES[index])
+        {
+            algorithm = (ALGORITHM)index;
+            return true;
+        }
+
+    return false;
+}
+
+bool ParseNumbers(const std::string& text, std::vector<double>& numbers)
+{
+    std::stringstream textStream(text);
+    std::string       number;
+    char*             numberEnd;
+
+    numbers.clear();
+
+    while (std::getline(textStream, number, ',').fail() == false)
+    {
+        numbers.push_back(strtod(number.c_str(), &numberEnd));
+        EXECUTION_CONDITION(number.empty() == false && *numberEnd == '\0', false);
+    }
+
+    return numbers.empty() == false;
+}
+
+// A job line is an algorithm name followed by key=value pairs, values may be double-quoted to hold spaces:
+//     koch size=1000x1000 steps=5 output="Output/Koch Curve.ppm"
+bool ParseJob(const std::string& line, RenderJob& job)
+{
+    std::stringstream   lineStream(line);
+    std::string         token;
+    std::string         key;
+    std::string         value;
+    std::vector<double> numbers;
+    ALGORITHM           algorithm;
+    char                character;
+    bool                isMapGiven    = false;
+    bool                isBoundsGiven = false;
+
+    lineStream >> token;
+    EXECUTION_CONDITION(ParseAlgorithm(token, algorithm), false);
+
+    job = CreateDefaultJob(algorithm, REFERENCE_SIZE, std::string(ALGORITHM_NAMES[(int)algorithm]) + ((algorithm == ALGORITHM::MANDELBROT) ? (".pgm") : (".ppm")));
+
+    while (lineStream >> std::ws && lineStream.eof() == false)
+    {
+        key.clear();
+        value.clear();
+
+        while (lineStream.get(character) && character != '=')
+            key.push_back(character);
+
+        if (lineStream.peek() == '"')
+        {
+            lineStream.get(character);
+
+            while (lineStream.get(character) && character != '"')
+                value.push_back(character);
+        }
+        else
+            lineStream >> value;
+
+        if (key == "output")
+            job.outputPath = value;
+        else if (key == "size")
+        {
+            std::replace(value.begin(), value.end(), 'x', ',');
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() == 2 && numbers[0] >= 1 && numbers[1] >= 1, false);
+
+            job.imageSize = { (coord_t)numbers[0], (coord_t)numbers[1] };
+        }
+        else if (key == "steps")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() == 1 && numbers[0] >= 0 && numbers[0] <= INT_MAX, false);
+
+            job.steps = (int)numbers[0];
+        }
+        else if (key == "seed")
+        {
+            EXECUTION_CONDITION(value.empty() == false && value.find_first_not_of("0123456789") == std::string::npos, false);
+
+            job.seed = strtoull(value.c_str(), nullptr, 10);
+        }
+        else if (key == "shading")
+        {
+            EXECUTION_CONDITION(value == "binary" || value == "density", false);
+
+            job.isDensity = (value == "density");
+        }
+        else if (key == "lines")
+        {
+            EXECUTION_CONDITION(value == LINE_MODE_NAMES[0] || value == LINE_MODE_NAMES[1], false);
+
+            job.lineMode = (value == LINE_MODE_NAMES[0]) ? (LINEMODE::ALIASED) : (LINEMODE::ANTIALIASED);
+        }
+        else if (key == "spline")
+        {
+            EXECUTION_CONDITION(value == SPLINE_NAMES[0] || value == SPLINE_NAMES[1] || value == SPLINE_NAMES[2], false);
+
+            job.spline = (value == SPLINE_NAMES[0]) ? (SPLINE::BEZIER) : ((value == SPLINE_NAMES[1]) ? (SPLINE::BSPLINE) : (SPLINE::CATMULL_ROM));
+        }
+        else if (key == "flatness")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() == 1 && numbers[0] > 0.0, false);
+
+            job.flatness = numbers[0];
+        }
+        else if (key == "system")
+        {
+            if (value == IFS_SYSTEM_NAMES[0])
+                job.system = CreateBarnsleyFern();
+            else if (value == IFS_SYSTEM_NAMES[1])
+                job.system = CreateSierpinskiCarpet();
+            else if (value == IFS_SYSTEM_NAMES[2])
+                job.system = CreateSierpinskiTriangle();
+            else
+                return false;
+
+            isBoundsGiven = true;
+        }
+        else if (key == "maps")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() % 7 == 0, false);
+
+            job.system.maps.clear();
+            isMapGiven = true;
+
+            for (size_t index = 0; index < numbers.size(); index += 7)
+            {
+                EXECUTION_CONDITION(numbers[index + 6] > 0.0, false);
+                job.system.maps.push_back({ numbers[index], numbers[index + 1], numbers[index + 2], numbers[index + 3], numbers[index + 4], numbers[index + 5], numbers[index + 6] });
+            }
+        }
+        else if (key == "bounds")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() == 4 && numbers[0] < numbers[2] && numbers[1] < numbers[3], false);
+
+            job.system.bounds = { numbers[0], numbers[3], numbers[2], numbers[1] };
+            isBoundsGiven     = true;
+        }
+        else if (key == "points")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() >= 4 && numbers.size() % 2 == 0, false);
+
+            job.points.clear();
+
+            for (size_t index = 0; index < numbers.size(); index += 2)
+                job.points.push_back({ (coord_t)numbers[index], (coord_t)numbers[index + 1] });
+        }
+        else if (key == "center")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() == 2, false);
+
+            job.center = std::make_tuple(numbers[0], numbers[1]);
+        }
+        else if (key == "viewport")
+        {
+            EXECUTION_CONDITION(ParseNumbers(value, numbers) && numbers.size() == 2 && numbers[0] > 0.0 && numbers[1] > 0.0, false);
+
+            job.viewport = std::make_tuple(numbers[0], numbers[1]);
+        }
+        else
+            return false;
+    }
+
+    // Maps of our own with no bounds are framed by a trial walk; a preset brings its bounds along.
+    if (isMapGiven == true && isBoundsGiven == false)
+        job.system.bounds = EstimateIFSBounds(job.system.maps, job.seed);
+
+    return true;
+}
+
+bool ReadJobs(const char* filePath, std::vector<RenderJob>& jobs)
+{
+    FILE*     fileStream = fopen(filePath, "rt");
+    char      buffer[4096];
+    int       lineNumber = 0;
+    RenderJob job;
+
+    if (fileStream == nullptr)
+    {
+        fprintf(stderr, "Cannot open job file \"%s\"\n", filePath);
+        return false;
+    }
+
+    while (fgets(buffer, sizeof(buffer), fileStream) != nullptr)
+    {
+        std::string line(buffer);
+
+        lineNumber += 1;
+        line        = line.substr(0, line.find('#'));
+
+        if (line.find_first_not_of(" \t\r\n") == std::string::npos)
+            continue;
+
+        if (ParseJob(line, job) == false)
+        {
+            fprintf(stderr, "%s:%d: invalid job \"%s\"\n", filePath, lineNumber, line.substr(0, line.find_last_not_of(" \t\r\n") + 1).c_str());
+            fclose(fileStream);
+
+            return false;
+        }
+
+        jobs.push_back(job);
+    }
+
+    fclose(fileStream);
+
+    return true;
+}
+
+std::vector<RenderJob> CreateGalleryJobs(PixelSize imageSize, std::string directory)
+{
+    std::vector<RenderJob> jobs;
+
+    if (directory.empty() == false && directory.back() != '/' && directory.back() != '\\')
+        directory.push_back('/');
+
+    for (int algorithm = 0; algorithm < ALGORITHM_COUNT; ++algorithm)
+        jobs.push_back(CreateDefaultJob((ALGORITHM)algorithm, imageSize, directory + GALLERY_FILE_NAMES[algorithm]));
+
+    return jobs;
+}
+
+// Draws the same scenes as the standalone programs, scaled from REFERENCE_SIZE to the job's resolution.
+void DrawScene(const RenderJob& job, Framebuffer<RGB8>& image, int threadCount)
+{
+    PixelSize               imageSize = job.imageSize;
+    RandomEngine            randomEngine(job.seed);
+    std::vector<PixelPoint> points;
+    ShapeBatch<RGB8>        shapeBatch;
+    CommandBuffer<RGB8>     commandBuffer;
+
+    image.Clear({ 255, 255, 255 });
+
+    switch (job.algorithm)
+    {
+    case ALGORITHM::DDA_LINE:
+        commandBuffer.AddDDALine(ScalePoint({ 50, 50 },   imageSize), ScalePoint({ 250, 250 }, imageSize), { 0, 0, 0 },   LINETYPE::SOLID);
+        commandBuffer.AddDDALine(ScalePoint({ 400, 300 }, imageSize), ScalePoint({ 0, 0 },     imageSize), { 255, 0, 0 }, LINETYPE::SOLID);
+        commandBuffer.AddDDALine(ScalePoint({ 200, 100 }, imageSize), ScalePoint({ 250, 250 }, imageSize), { 0, 255, 0 }, LINETYPE::DASHED);
+        commandBuffer.AddDDALine(ScalePoint({ 475, 475 }, imageSize), ScalePoint({ 125, 250 }, imageSize), { 0, 0, 255 }, LINETYPE::DOTTED);
+
+        ExecuteCommandBuffer(image, commandBuffer, threadCount);
+        break;
+
+    case ALGORITHM::BRESENHAM_LINE:
+        commandBuffer.AddBresenhamLine(ScalePoint({ 50, 50 },   imageSize), ScalePoint({ 250, 250 }, imageSize), { 0, 0, 0 },   LINETYPE::SOLID);
+        commandBuffer.AddBresenhamLine(ScalePoint({ 200, 150 }, imageSize), ScalePoint({ 450, 15 },  imageSize), { 255, 0, 0 }, LINETYPE::SOLID);
+        commandBuffer.AddBresenhamLine(ScalePoint({ 25, 100 },  imageSize), ScalePoint({ 300, 250 }, imageSize), { 0, 255, 0 }, LINETYPE::DASHED);
+        commandBuffer.AddBresenhamLine(ScalePoint({ 450, 550 }, imageSize), ScalePoint({ 125, 250 }, imageSize), { 0, 0, 255 }, LINETYPE::DOTTED);
+
+        ExecuteCommandBuffer(image, commandBuffer, threadCount);
+        break;
+
+    case ALGORITHM::CIRCLE:
+        commandBuffer.AddCircle(ScalePoint({ 150, 150 }, imageSize), ScaleLength(100, imageSize), { 255, 0, 0 });
+        commandBuffer.AddCircle(ScalePoint({ 300, 250 }, imageSize), ScaleLength(200, imageSize), { 0, 255, 0 });
+        commandBuffer.AddCircle(ScalePoint({ 125, 225 }, imageSize), ScaleLength(150, imageSize), { 0, 0, 255 });
+
+        ExecuteCommandBuffer(image, commandBuffer, threadCount);
+        break;
+
+    case ALGORITHM::ELLIPSE:
+        commandBuffer.AddEllipse(ScalePoint({ 150, 150 }, imageSize), ScaleSize({ 100, 200 }, imageSize), 0,   { 255, 0, 0 });
+        commandBuffer.AddEllipse(ScalePoint({ 300, 250 }, imageSize), ScaleSize({ 50, 150 },  imageSize), 75,  { 0, 255, 0 });
+        commandBuffer.AddEllipse(ScalePoint({ 125, 225 }, imageSize), ScaleSize({ 175, 150 }, imageSize), 120, { 0, 0, 255 });
+
+        ExecuteCommandBuffer(image, commandBuffer, threadCount);
+        break;
+
+    case ALGORITHM::KOCH_CURVE:
+        DrawKochCurve(image, ScalePoint({ 100, 100 }, imageSize), ScalePoint({ 400, 100 }, imageSize), ScalePoint({ 250, 400 }, imageSize), job.steps, { 0, 0, 0 }, job.lineMode);
+        break;
+
+    case ALGORITHM::NORMAL_TREE:
+        DrawNormalTree(image, ScalePoint({ 250, 400 }, imageSize), ScalePoint({ 250, 250 }, imageSize), 0.6F, 45, job.steps, { 0, 0, 0 }, threadCount, job.lineMode);
+        break;
+
+    case ALGORITHM::RANDOM_TREE:
+        DrawRandomTree(image, ScalePoint({ 250, 400 }, imageSize), ScalePoint({ 250, 250 }, imageSize), job.steps, { 0, 0, 0 }, randomEngine, threadCount, job.lineMode);
+        break;
+
+    case ALGORITHM::SIERPINSKI_GASKET:
+        if (job.isDensity == true)
+        {
+            DrawSierpinskiGasketDensity(image, ScalePoint({ 250, 100 }, imageSize), ScalePoint({ 100, 400 }, imageSize), ScalePoint({ 400, 400 }, imageSize), job.steps, { 0, 0, 0 }, job.seed, threadCount);
+            break;
+        }
+
+        DrawSierpinskiGasket(image, ScalePoint({ 250, 100 }, imageSize), ScalePoint({ 100, 400 }, imageSize), ScalePoint({ 400, 400 }, imageSize), job.steps, { 0, 0, 0 }, randomEngine);
+        break;
+
+    case ALGORITHM::BEZIER_SPLINE:
+        for (const PixelPoint& point : job.points)
+            points.push_back(ScalePoint(point, imageSize));
+
+        // A Bezier curve is sampled at a fixed step count unless a flatness is given; composite splines are always adaptive.
+        if (job.spline == SPLINE::BEZIER && job.flatness == 0.0)
+            DrawBezierSpline(image, points, std::max(job.steps, 1), { 0, 0, 0 }, job.lineMode);
+        else
+            DrawSpline(image, points, job.spline, (job.flatness > 0.0) ? (job.flatness) : (BEZIER_FLATNESS), { 0, 0, 0 }, job.lineMode);
+
+        break;
+
+    case ALGORITHM::IFS:
+        DrawIFS(image, job.system, job.steps, { 0, 100, 0 }, job.seed, threadCount);
+        break;
+
+    case ALGORITHM::WU_LINE:
+        DrawWuLine(image, ScalePoint({ 50, 50 },   imageSize), ScalePoint({ 250, 250 }, imageSize), { 0, 0, 0 },   LINETYPE::SOLID);
+        DrawWuLine(image, ScalePoint({ 400, 300 }, imageSize), ScalePoint({ 0, 0 },     imageSize), { 255, 0, 0 }, LINETYPE::SOLID);
+        DrawWuLine(image, ScalePoint({ 200, 100 }, imageSize), ScalePoint({ 250, 250 }, imageSize), { 0, 255, 0 }, LINETYPE::DASHED);
+        DrawWuLine(image, ScalePoint({ 475, 475 }, imageSize), ScalePoint({ 125, 250 }, imageSize), { 0, 0, 255 }, LINETYPE::DOTTED);
+        break;
+
+    case ALGORITHM::FILLED_SHAPES:
+        shapeBatch.AddCircle(ScalePoint({ 300, 250 }, imageSize), ScaleLength(200, imageSize), { 0, 255, 0 });
+        shapeBatch.AddCircle(ScalePoint({ 125, 225 }, imageSize), ScaleLength(150, imageSize), { 0, 0, 255 });
+        shapeBatch.AddCircle(ScalePoint({ 150, 150 }, imageSize), ScaleLength(100, imageSize), { 255, 0, 0 });
+        shapeBatch.AddEllipse(ScalePoint({ 150, 400 }, imageSize), ScaleSize({ 100, 40 }, imageSize), 0,   { 255, 255, 0 });
+        shapeBatch.AddEllipse(ScalePoint({ 300, 250 }, imageSize), ScaleSize({ 50, 150 }, imageSize), 75,  { 255, 0, 255 });
+        shapeBatch.AddEllipse(ScalePoint({ 400, 400 }, imageSize), ScaleSize({ 75, 30 },  imageSize), 120, { 0, 255, 255 });
+
+        FillShapeBatch(image, shapeBatch, threadCount);
+        break;
+
+    default:
+        break;
+    }
+}
+
+// Mandelbrot streams its grey image by bands; huge colour images are drawn in place in a mapped file.
+bool ExecuteJob(const RenderJob& job, RenderBuffer& buffer, int threadCount)
+{
+    PixelSize        imageSize = job.imageSize;
+    MappedPXM<RGB8>  mappedImage;
+    MandelbrotOption option;
+
+    if (job.algorithm == ALGORITHM::MANDELBROT)
+    {
+        // The first and last pixel of each axis map onto the viewport's edges, which takes two pixels an axis.
+        EXECUTION_CONDITION(imageSize.cx >= 2 && imageSize.cy >= 2, false);
+
+        buffer.iterationImage.resize((size_t)imageSize.cx * imageSize.cy);
+
+        option             = GetDefaultMandelbrotOption();
+        option.threadCount = threadCount;
+
+        if (std::get<0>(job.viewport) < DEEP_ZOOM_THRESHOLD)
+            ComputeMandelbrotDeep(buffer.iterationImage.data(), imageSize, std::make_tuple(PreciseNumber(std::get<0>(job.center)), PreciseNumber(std::get<1>(job.center))), job.viewport, option);
+        else
+            ComputeMandelbrot(buffer.iterationImage.data(), imageSize, job.center, job.viewport, option);
+
+        return WriteIterationImage<Gray8>(job.outputPath.c_str(), buffer.iterationImage.data(), imageSize);
+    }
+
+    if ((size_t)imageSize.cx * imageSize.cy >= MAPPED_PIXEL_COUNT)
+    {
+        EXECUTION_CONDITION(mappedImage.Open(job.outputPath.c_str(), imageSize.cx, imageSize.cy), false);
+        DrawScene(job, mappedImage.GetFramebuffer(), threadCount);
+
+        return mappedImage.Close();
+    }
+
+    buffer.colorImage.Resize(imageSize.cx, imageSize.cy);
+    DrawScene(job, buffer.colorImage, threadCount);
+
+    return WritePXM(job.outputPath.c_str(), buffer.colorImage);
+}
+
+bool RunJobs(const std::vector<RenderJob>& jobs, int threadCount)
+{
+    int                      workerCount = std::max(1, std::min(threadCount, (int)jobs.size()));
+    int                      failedCount = 0;
+    std::atomic<int>         nextJob(0);
+    std::mutex               outputMutex;
+    std::vector<std::thread> workers;
+
+    // Jobs run side by side, so a Mandelbrot job only gets its share of the threads for its own tiles.
+    for (int worker = 0; worker < workerCount; ++worker)
+        workers.emplace_back([&]()
+        {
+            RenderBuffer buffer;
+
+            for (int jobIndex = nextJob++; jobIndex < (int)jobs.size(); jobIndex = nextJob++)
+            {
+                std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+                bool                                           isWritten = ExecuteJob(jobs[jobIndex], buffer, std::max(1, threadCount / workerCount));
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+
+                if (isWritten == false)
+                {
+                    fprintf(stderr, "[%d/%d] Could not render %s\n", jobIndex + 1, (int)jobs.size(), jobs[jobIndex].outputPath.c_str());
+                    failedCount += 1;
+                    continue;
+                }
+
+                printf("[%d/%d] %-12s %5ldx%-5ld %10.2f ms  %s\n", jobIndex + 1, (int)jobs.size(), ALGORITHM_NAMES[(int)jobs[jobIndex].algorithm], (long)jobs[jobIndex].imageSize.cx, (long)jobs[jobIndex].imageSize.cy,
+                       std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count(), jobs[jobIndex].outputPath.c_str());
+            }
+        });
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    return failedCount == 0;
+}
+
+// The per-pixel checked loops the line and conic primitives ran before they clipped up front, kept as the --benchmark baseline.
+template <typename FORMAT>
+void DrawCheckedDDALine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    PixelSize variation   = { endPoint.x - startPoint.x, endPoint.y - startPoint.y };
+    long long step        = std::max(llabs(variation.cx), llabs(variation.cy));
+    long long denominator = std::max(2 * step, 1LL);
+
+    for (long long index = 0; index <= step; ++index)
+        if (LINE_STYLES[(int)lineType][index % 8] == true)
+            SetPixel(framebuffer, { startPoint.x + (coord_t)FloorDivide(2 * index * variation.cx + step, denominator), startPoint.y + (coord_t)FloorDivide(2 * index * variation.cy + step, denominator) }, color);
+}
+
+template <typename FORMAT>
+void DrawCheckedBresenhamLine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    PixelSize  variation = { abs(endPoint.x - startPoint.x), abs(endPoint.y - startPoint.y) };
+    PixelPoint tempPoint;
+    int        discriminant;
+    int        direction;
+    int        index;
+
+    if (variation.cx > variation.cy)
+    {
+        discriminant = 2 * variation.cy - variation.cx;
+        index        = 0;
+
+        if (startPoint.x > endPoint.x)
+        {
+            direction = (startPoint.y > endPoint.y) ? (1) : (-1);
+            SWAP(startPoint, endPoint, tempPoint);
+        }
+        else
+            direction = (startPoint.y < endPoint.y) ? (1) : (-1);
+
+        while (startPoint.x <= endPoint.x)
+        {
+            if (LINE_STYLES[(int)lineType][index % 8] == true)
+                SetPixel(framebuffer, startPoint, color);
+
+            startPoint.x += 1;
+            startPoint.y += (discriminant < 0) ? (0) : (direction);
+            discriminant += (discriminant < 0) ? (2 * variation.cy) : (2 * (variation.cy - variation.cx));
+            index        += 1;
+        }
+    }
+    else
+    {
+        discriminant = 2 * variation.cx - variation.cy;
+        index        = 0;
+
+        if (startPoint.y > endPoint.y)
+        {
+            direction = (startPoint.x > endPoint.x) ? (1) : (-1);
+            SWAP(startPoint, endPoint, tempPoint);
+        }
+        else
+            direction = (startPoint.x < endPoint.x) ? (1) : (-1);
+
+        while (startPoint.y <= endPoint.y)
+        {
+            if (LINE_STYLES[(int)lineType][index % 8] == true)
+                SetPixel(framebuffer, startPoint, color);
+
+            startPoint.x += (discriminant < 0) ? (0) : (direction);
+            startPoint.y += 1;
+            discriminant += (discriminant < 0) ? (2 * variation.cx) : (2 * (variation.cx - variation.cy));
+            index        += 1;
+        }
+    }
+}
+
+template <typename FORMAT>
+void DrawCheckedCircle(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, coord_t radius, typename FORMAT::ColorType color)
+{
+    PixelPoint symmetryPoint = { 0, radius };
+    int        discriminant  = 1 - radius;
+
+    while (symmetryPoint.x <= symmetryPoint.y)
+    {
+        SetPixel(framebuffer, { centerPoint.x + symmetryPoint.x, centerPoint.y + symmetryPoint.y }, color);
+        SetPixel(framebuffer, { centerPoint.x + symmetryPoint.x, centerPoint.y - symmetryPoint.y }, color);
+        SetPixel(framebuffer, { centerPoint.x - symmetryPoint.x, centerPoint.y + symmetryPoint.y }, color);
+        SetPixel(framebuffer, { centerPoint.x - symmetryPoint.x, centerPoint.y - symmetryPoint.y }, color);
+        SetPixel(framebuffer, { centerPoint.x + symmetryPoint.y, centerPoint.y + symmetryPoint.x }, color);
+        SetPixel(framebuffer, { centerPoint.x + symmetryPoint.y, centerPoint.y - symmetryPoint.x }, color);
+        SetPixel(framebuffer, { centerPoint.x - symmetryPoint.y, centerPoint.y + symmetryPoint.x }, color);
+        SetPixel(framebuffer, { centerPoint.x - symmetryPoint.y, centerPoint.y - symmetryPoint.x }, color);
+
+        symmetryPoint.x += 1;
+
+        if (discriminant < 0)
+            discriminant += 2 * symmetryPoint.x + 1;
+        else
+        {
+            symmetryPoint.y -= 1;
+            discriminant    += 2 * (symmetryPoint.x - symmetryPoint.y) + 1;
+        }
+    }
+}
+
+template <typename FORMAT>
+void DrawCheckedEllipse(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelSize radius, int theta, typename FORMAT::ColorType color)
+{
+    Size<long long>  squaredRadius     = { (long long)radius.cx * radius.cx, (long long)radius.cy * radius.cy };
+    PixelPoint       symmetryPoint     = { 0, radius.cy };
+    Point<long long> discriminantPoint = { 0, 2 * squaredRadius.cx * radius.cy };
+    int              angle             = (theta % 180 + 180) % 180;
+    long long        discriminant;
+
+    if (angle == 90)
+        return DrawCheckedEllipse(framebuffer, centerPoint, { radius.cy, radius.cx }, 0, color);
+
+    if (angle != 0 && radius.cx != radius.cy)
+    {
+        TraceEllipseOutline(centerPoint, radius, theta, centerPoint.y - radius.cx - radius.cy - 2, centerPoint.y + radius.cx + radius.cy + 2, [&](coord_t y, coord_t outerLeft, coord_t innerLeft, coord_t innerRight, coord_t outerRight)
+        {
+            for (coord_t x = outerLeft; x <= std::min(innerLeft, outerRight); ++x)
+                SetPixel(framebuffer, { x, y }, color);
+
+            for (coord_t x = std::max(innerRight, innerLeft + 1); x <= outerRight; ++x)
+                SetPixel(framebuffer, { x, y }, color);
+        });
+
+        return;
+    }
+
+    if (radius.cx == 0 || radius.cy == 0)
+    {
+        for (coord_t y = -radius.cy; y <= radius.cy; ++y)
+            for (coord_t x = -radius.cx; x <= radius.cx; ++x)
+                SetPixel(framebuffer, { centerPoint.x + x, centerPoint.y + y }, color);
+
+        return;
+    }
+
+    discriminant = (long long)(squaredRadius.cy - squaredRadius.cx * radius.cy + 0.25 * squaredRadius.cx + 0.5);
+
+    while (discriminantPoint.x <= discriminantPoint.y)
+    {
+        DrawEllipsePoints(framebuffer, centerPoint, symmetryPoint, CLIPPING::PARTIAL, color);
+
+        symmetryPoint.x     += 1;
+        discriminantPoint.x += 2 * squaredRadius.cy;
+
+        if (discriminant < 0)
+            discriminant += squaredRadius.cy + discriminantPoint.x;
+        else
+        {
+            symmetryPoint.y     -= 1;
+            discriminantPoint.y -= 2 * squaredRadius.cx;
+            discriminant        += squaredRadius.cy + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+
+    discriminant = (long long)(squaredRadius.cy * (symmetryPoint.x + 0.5) * (symmetryPoint.x + 0.5) + squaredRadius.cx * (symmetryPoint.y - 1) * (symmetryPoint.y - 1) - squaredRadius.cx * squaredRadius.cy);
+
+    while (symmetryPoint.y >= 0)
+    {
+        DrawEllipsePoints(framebuffer, centerPoint, symmetryPoint, CLIPPING::PARTIAL, color);
+
+        symmetryPoint.y     -= 1;
+        discriminantPoint.y -= 2 * squaredRadius.cx;
+
+        if (discriminant > 0)
+            discriminant += squaredRadius.cx - discriminantPoint.y;
+        else
+        {
+            symmetryPoint.x     += 1;
+            discriminantPoint.x += 2 * squaredRadius.cy;
+            discriminant        += squaredRadius.cx + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+}
+
+// The ellipse as it was drawn before the conic tracer: rotated and truncated midpoint points, which leave gaps.
+template <typename FORMAT>
+void DrawTrigonometricEllipsePoints(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelPoint symmetryPoint, float radian, CLIPPING clipping, typename FORMAT::ColorType color)
+{
+    PixelPoint points[4] =
+    {
+        { (int)(centerPoint.x + symmetryPoint.x * cos(radian) - symmetryPoint.y * sin(radian)),  (int)(centerPoint.y + symmetryPoint.x * sin(radian)  + symmetryPoint.y * cos(radian)) },
+        { (int)(centerPoint.x + symmetryPoint.x * cos(radian) - symmetryPoint.y * sin(-radian)), (int)(centerPoint.y - symmetryPoint.x * sin(-radian) - symmetryPoint.y * cos(radian)) },
+        { (int)(centerPoint.x - symmetryPoint.x * cos(radian) + symmetryPoint.y * sin(-radian)), (int)(centerPoint.y + symmetryPoint.x * sin(-radian) + symmetryPoint.y * cos(radian)) },
+        { (int)(centerPoint.x - symmetryPoint.x * cos(radian) + symmetryPoint.y * sin(radian)),  (int)(centerPoint.y - symmetryPoint.x * sin(radian)  - symmetryPoint.y * cos(radian)) }
+    };
+
+    for (const PixelPoint& point : points)
+    {
+        if (clipping == CLIPPING::INSIDE)
+            FORMAT::Store(framebuffer.GetPixel(point.x, point.y), color);
+        else
+            SetPixel(framebuffer, point, color);
+    }
+}
+
+template <typename FORMAT>
+Framebuffer<FORMAT>& DrawTrigonometricEllipse(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelSize radius, int theta, typename FORMAT::ColorType color)
+{
+    Size<long long>  squaredRadius     = { (long long)radius.cx * radius.cx, (long long)radius.cy * radius.cy };
+    PixelPoint       symmetryPoint     = { 0, radius.cy };
+    Point<long long> discriminantPoint = { 0, 2 * squaredRadius.cx * radius.cy };
+    float            radian            = theta * 3.141592F / 180.0F;
+    PixelSize        extent            = { (coord_t)hypot(radius.cx * cos(radian), radius.cy * sin(radian)) + 3, (coord_t)hypot(radius.cx * sin(radian), radius.cy * cos(radian)) + 3 };
+    CLIPPING         clipping          = ClipBoundingBox(framebuffer, { centerPoint.x - extent.cx, centerPoint.y - extent.cy, centerPoint.x + extent.cx, centerPoint.y + extent.cy });
+    long long        discriminant;
+
+    // The box is the rotated ellipse's extent plus three pixels for the midpoint error and the truncating rounding of the rotated points.
+    EXECUTION_CONDITION(clipping != CLIPPING::OUTSIDE, framebuffer);
+
+    discriminant = (long long)(squaredRadius.cy - squaredRadius.cx * radius.cy + 0.25 * squaredRadius.cx + 0.5);
+
+    while (discriminantPoint.x <= discriminantPoint.y)
+    {
+        DrawTrigonometricEllipsePoints(framebuffer, centerPoint, symmetryPoint, radian, clipping, color);
+
+        symmetryPoint.x     += 1;
+        discriminantPoint.x += 2 * squaredRadius.cy;
+
+        if (discriminant < 0)
+            discriminant += squaredRadius.cy + discriminantPoint.x;
+        else
+        {
+            symmetryPoint.y     -= 1;
+            discriminantPoint.y -= 2 * squaredRadius.cx;
+            discriminant        += squaredRadius.cy + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+
+    discriminant = (long long)(squaredRadius.cy * (symmetryPoint.x + 0.5) * (symmetryPoint.x + 0.5) + squaredRadius.cx * (symmetryPoint.y - 1) * (symmetryPoint.y - 1) - squaredRadius.cx * squaredRadius.cy);
+
+    while (symmetryPoint.y > 0)
+    {
+        symmetryPoint.y     -= 1;
+        discriminantPoint.y -= 2 * squaredRadius.cx;
+
+        if (discriminant > 0)
+            discriminant += squaredRadius.cx - discriminantPoint.y;
+        else
+        {
+            symmetryPoint.x     += 1;
+            discriminantPoint.x += 2 * squaredRadius.cy;
+            discriminant        += squaredRadius.cx + discriminantPoint.x - discriminantPoint.y;
+        }
+
+        DrawTrigonometricEllipsePoints(framebuffer, centerPoint, symmetryPoint, radian, clipping, color);
+    }
+
+    return framebuffer;
+}
+
+// The DDA as it was before fixed point, kept as the --benchmark baseline.
+template <typename FORMAT>
+Framebuffer<FORMAT>& DrawFloatDDALine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    PixelSize  variation      = { endPoint.x - startPoint.x, endPoint.y - startPoint.y };
+    long       step           = (abs(variation.cx) > abs(variation.cy)) ? (abs(variation.cx)) : (abs(variation.cy));
+    float      rounding       = (float)step + 0.5F;
+    float      increaseX      = (float)variation.cx / (float)step;
+    float      increaseY      = (float)variation.cy / (float)step;
+    double     errorMargin    = 1.0 + (step + 1.0) * FLT_EPSILON * (abs(startPoint.x) + abs(startPoint.y) + abs(endPoint.x) + abs(endPoint.y));
+    double     firstParameter = 0.0;
+    double     lastParameter  = (double)step;
+    double     innerFirst     = 0.0;
+    double     innerLast      = (double)step;
+    long       firstIndex;
+    long       lastIndex;
+    long       innerFirstIndex;
+    long       innerLastIndex;
+    PixelPoint point;
+    PixelPoint previousPoint;
+    byte_t*    pixel          = nullptr;
+
+    if (step == 0)
+    {
+        if (LINE_STYLES[(int)lineType][0] == true)
+            SetPixel(framebuffer, startPoint, color);
+
+        return framebuffer;
+    }
+
+    // Liang-Barsky twice, with a margin for the float error: outer indices may round in, inner ones cannot round out.
+    EXECUTION_CONDITION(ClipParameter(startPoint.x, increaseX, -1.5 - errorMargin, framebuffer.GetWidth()  - 0.5 + errorMargin, firstParameter, lastParameter), framebuffer);
+    EXECUTION_CONDITION(ClipParameter(startPoint.y, increaseY, -1.5 - errorMargin, framebuffer.GetHeight() - 0.5 + errorMargin, firstParameter, lastParameter), framebuffer);
+
+    firstIndex = (long)ceil(firstParameter);
+    lastIndex  = (long)floor(lastParameter);
+
+    if (ClipParameter(startPoint.x, increaseX, errorMargin, framebuffer.GetWidth()  - 1.0 - errorMargin, innerFirst, innerLast) == true &&
+        ClipParameter(startPoint.y, increaseY, errorMargin, framebuffer.GetHeight() - 1.0 - errorMargin, innerFirst, innerLast) == true)
+    {
+        innerFirstIndex = (long)ceil(innerFirst);
+        innerLastIndex  = (long)floor(innerLast);
+    }
+    else
+    {
+        innerFirstIndex = step + 1;
+        innerLastIndex  = step;
+    }
+
+    for (long index = firstIndex; index <= lastIndex; ++index)
+    {
+        if (LINE_STYLES[(int)lineType][index % 8] == true)
+        {
+            point = { startPoint.x + (int)(index * increaseX + rounding) - (int)step, startPoint.y + (int)(index * increaseY + rounding) - (int)step };
+
+            if (index >= innerFirstIndex && index <= innerLastIndex)
+            {
+                pixel         = (pixel == nullptr) ? (framebuffer.GetPixel(point.x, point.y)) : (pixel + framebuffer.GetOffset(point.x - previousPoint.x, point.y - previousPoint.y));
+                previousPoint = point;
+
+                FORMAT::Store(pixel, color);
+            }
+            else
+                SetPixel(framebuffer, point, color);
+        }
+    }
+
+    return framebuffer;
+}
+
+// The Bresenham run as it was walked before slices: one pixel per step, the dash looked up in LINE_STYLES per pixel.
+template <typename FORMAT>
+void DrawSteppedBresenhamRun(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, coord_t majorLength, coord_t minorLength, int direction, bool isMajorX, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    long long firstIndex;
+    long long lastIndex;
+    long long minorOffset;
+    long long discriminant;
+    ptrdiff_t majorStep;
+    ptrdiff_t minorStep;
+    byte_t*   pixel;
+    bool      isVisible;
+
+    if (isMajorX == true)
+        isVisible = ClipBresenhamRun(startPoint.x, startPoint.y, majorLength, minorLength, direction, framebuffer.GetWidth(),  framebuffer.GetHeight(), firstIndex, lastIndex);
+    else
+        isVisible = ClipBresenhamRun(startPoint.y, startPoint.x, majorLength, minorLength, direction, framebuffer.GetHeight(), framebuffer.GetWidth(),  firstIndex, lastIndex);
+
+    if (isVisible == false)
+        return;
+
+    minorOffset  = (2LL * minorLength * firstIndex + majorLength) / (2LL * majorLength);
+    discriminant = 2LL * minorLength * (firstIndex + 1) - majorLength - 2LL * majorLength * minorOffset;
+    majorStep    = (isMajorX == true) ? (framebuffer.GetOffset(1, 0))         : (framebuffer.GetOffset(0, 1));
+    minorStep    = (isMajorX == true) ? (framebuffer.GetOffset(0, direction)) : (framebuffer.GetOffset(direction, 0));
+
+    if (isMajorX == true)
+        pixel = framebuffer.GetPixel(startPoint.x + (coord_t)firstIndex, startPoint.y + direction * (coord_t)minorOffset);
+    else
+        pixel = framebuffer.GetPixel(startPoint.x + direction * (coord_t)minorOffset, startPoint.y + (coord_t)firstIndex);
+
+    for (long long index = firstIndex; index <= lastIndex; ++index)
+    {
+        if (LINE_STYLES[(int)lineType][index % 8] == true)
+            FORMAT::Store(pixel, color);
+
+        if (index == lastIndex)
+            break;
+
+        pixel        += (discriminant < 0) ? (majorStep) : (majorStep + minorStep);
+        discriminant += (discriminant < 0) ? (2 * minorLength) : (2 * (minorLength - majorLength));
+    }
+}
+
+template <typename FORMAT>
+Framebuffer<FORMAT>& DrawSteppedBresenhamLine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    PixelSize  variation = { abs(endPoint.x - startPoint.x), abs(endPoint.y - startPoint.y) };
+    PixelPoint tempPoint;
+    int        direction;
+
+    if (variation.cx > variation.cy)
+    {
+        if (startPoint.x > endPoint.x)
+        {
+            direction = (startPoint.y > endPoint.y) ? (1) : (-1);
+            SWAP(startPoint, endPoint, tempPoint);
+        }
+        else
+            direction = (startPoint.y < endPoint.y) ? (1) : (-1);
+
+        DrawSteppedBresenhamRun(framebuffer, startPoint, variation.cx, variation.cy, direction, true, color, lineType);
+    }
+    else if (variation.cy > 0)
+    {
+        if (startPoint.y > endPoint.y)
+        {
+            direction = (startPoint.x > endPoint.x) ? (1) : (-1);
+            SWAP(startPoint, endPoint, tempPoint);
+        }
+        else
+            direction = (startPoint.x < endPoint.x) ? (1) : (-1);
+
+        DrawSteppedBresenhamRun(framebuffer, startPoint, variation.cy, variation.cx, direction, false, color, lineType);
+    }
+    else if (LINE_STYLES[(int)lineType][0] == true)
+        SetPixel(framebuffer, startPoint, color);
+
+    return framebuffer;
+}
+
+// Draws the same seeded shapes every call; a third of the scene lies off the image so clipping has work to skip.
+double MeasurePrimitives(Framebuffer<RGB8>& image, int primitive, bool isChecked)
+{
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> xDistribution(-image.GetWidth() / 2, image.GetWidth() * 3 / 2);
+    std::uniform_int_distribution<int> yDistribution(-image.GetHeight() / 2, image.GetHeight() * 3 / 2);
+    std::uniform_int_distribution<int> radiusDistribution(1, image.GetHeight() / 2);
+    std::uniform_int_distribution<int> angleDistribution(0, 359);
+    PixelPoint                         startPoint;
+    PixelPoint                         endPoint;
+    PixelSize                          radius;
+    PixelColor                         color;
+
+    image.Clear({ 255, 255, 255 });
+
+    std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+    for (int index = 0; index < BENCHMARK_PRIMITIVE_COUNT; ++index)
+    {
+        startPoint = { xDistribution(randomEngine), yDistribution(randomEngine) };
+        endPoint   = { xDistribution(randomEngine), yDistribution(randomEngine) };
+        radius     = { radiusDistribution(randomEngine), radiusDistribution(randomEngine) };
+        color      = { (byte_t)index, (byte_t)(index >> 8), (byte_t)(index >> 16) };
+
+        switch (primitive)
+        {
+        case 0:
+            if (isChecked == true)
+                DrawCheckedDDALine(image, startPoint, endPoint, color, LINETYPE::SOLID);
+            else
+                DrawDDALine(image, startPoint, endPoint, color, LINETYPE::SOLID);
+
+            break;
+
+        case 1:
+            if (isChecked == true)
+                DrawCheckedBresenhamLine(image, startPoint, endPoint, color, LINETYPE::SOLID);
+            else
+                DrawBresenhamLine(image, startPoint, endPoint, color, LINETYPE::SOLID);
+
+            break;
+
+        case 2:
+            if (isChecked == true)
+                DrawCheckedCircle(image, startPoint, radius.cx, color);
+            else
+                DrawCircle(image, startPoint, radius.cx, color);
+
+            break;
+
+        default:
+            if (isChecked == true)
+                DrawCheckedEllipse(image, startPoint, radius, angleDistribution(randomEngine), color);
+            else
+                DrawEllipse(image, startPoint, radius, angleDistribution(randomEngine), color);
+
+            break;
+        }
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+void BenchmarkPrimitives()
+{
+    const char*       primitiveNames[4] = { "DDA Line", "Bresenham", "Circle", "Ellipse" };
+    Framebuffer<RGB8> checkedImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8> clippedImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    double            checkedTime;
+    double            clippedTime;
+
+    printf("%d primitives per run on a %ldx%ld image\n\n", BENCHMARK_PRIMITIVE_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy);
+    printf("%10s %12s %12s %8s %10s\n", "Primitive", "Checked (ms)", "Clipped (ms)", "Speedup", "Identical");
+
+    for (int primitive = 0; primitive < 4; ++primitive)
+    {
+        checkedTime = MeasurePrimitives(checkedImage, primitive, true);
+        clippedTime = MeasurePrimitives(clippedImage, primitive, false);
+
+        printf("%10s %12.2f %12.2f %8.2f %10s\n", primitiveNames[primitive], checkedTime, clippedTime, checkedTime / clippedTime, (memcmp(checkedImage.GetData(), clippedImage.GetData(), checkedImage.GetByteCount()) == 0) ? ("yes") : ("no"));
+    }
+}
+
+// Times runFunction on thread counts doubling up to maxThreadCount and hands each count and time to rowFunction.
+template <typename RUNFUNCTION, typename ROWFUNCTION>
+void MeasureThreadCounts(int maxThreadCount, RUNFUNCTION runFunction, ROWFUNCTION rowFunction)
+{
+    for (int threadCount = 1; threadCount <= maxThreadCount; threadCount = (threadCount < maxThreadCount) ? (std::min(threadCount * 2, maxThreadCount)) : (threadCount + 1))
+    {
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        runFunction(threadCount);
+
+        rowFunction(threadCount, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count());
+    }
+}
+
+template <typename FORMAT>
+inline bool IsSameImage(const Framebuffer<FORMAT>& image1, const Framebuffer<FORMAT>& image2)
+{
+    return image1.GetByteCount() == image2.GetByteCount() && memcmp(image1.GetData(), image2.GetData(), image1.GetByteCount()) == 0;
+}
+
+// Every thread count must reproduce the single-threaded hit counts, the walks being seeded per walk rather than per thread.
+void BenchmarkChaosGame(int maxThreadCount)
+{
+    std::vector<uint32_t> referenceHitCounts;
+    std::vector<uint32_t> hitCounts;
+    double                referenceTime = 0.0;
+
+    printf("\n%lld chaos game points on a %ldx%ld image\n\n", BENCHMARK_CHAOS_STEPS, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy);
+    printf("%10s %12s %14s %8s %10s\n", "Threads", "Time (ms)", "Points/s", "Speedup", "Identical");
+
+    MeasureThreadCounts(maxThreadCount, [&](int threadCount)
+    {
+        ComputeChaosGameHits(hitCounts, BENCHMARK_SIZE, { 960, 40 }, { 120, 1040 }, { 1800, 1040 }, BENCHMARK_CHAOS_STEPS, DEFAULT_SEED, threadCount);
+    },
+    [&](int threadCount, double elapsedTime)
+    {
+        if (threadCount == 1)
+        {
+            referenceHitCounts = hitCounts;
+            referenceTime      = elapsedTime;
+        }
+
+        printf("%10d %12.2f %14.4g %8.2f %10s\n", threadCount, elapsedTime, BENCHMARK_CHAOS_STEPS / elapsedTime * 1000.0, referenceTime / elapsedTime, (hitCounts == referenceHitCounts) ? ("yes") : ("no"));
+    });
+}
+
+void BenchmarkIFS(int maxThreadCount)
+{
+    IteratedFunctionSystem systems[3] = { CreateBarnsleyFern(), CreateSierpinskiCarpet(), CreateSierpinskiTriangle() };
+    std::vector<uint32_t>  referenceHitCounts;
+    std::vector<uint32_t>  hitCounts;
+    double                 referenceTime = 0.0;
+
+    printf("\n%lld IFS points on a %ldx%ld image\n\n", BENCHMARK_CHAOS_STEPS, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy);
+    printf("%10s %10s %12s %14s %8s %10s\n", "System", "Threads", "Time (ms)", "Points/s", "Speedup", "Identical");
+
+    for (int system = 0; system < 3; ++system)
+        MeasureThreadCounts(maxThreadCount, [&](int threadCount)
+        {
+            ComputeIFSHits(hitCounts, BENCHMARK_SIZE, systems[system], BENCHMARK_CHAOS_STEPS, DEFAULT_SEED, threadCount);
+        },
+        [&](int threadCount, double elapsedTime)
+        {
+            if (threadCount == 1)
+            {
+                referenceHitCounts = hitCounts;
+                referenceTime      = elapsedTime;
+            }
+
+            printf("%10s %10d %12.2f %14.4g %8.2f %10s\n", IFS_SYSTEM_NAMES[system], threadCount, elapsedTime, BENCHMARK_CHAOS_STEPS / elapsedTime * 1000.0, referenceTime / elapsedTime, (hitCounts == referenceHitCounts) ? ("yes") : ("no"));
+        });
+}
+
+// Tessellates and draws the same seeded curves at fixed steps and adaptively, from a few pixels across to the whole image.
+void BenchmarkBezier()
+{
+    const char*                curveNames[4]  = { "Cubic", "Cubic", "Cubic", "Degree 8" };
+    const coord_t              curveSpans[4]  = { 16, 200, 1000, 1000 };
+    const int                  pointCounts[4] = { 4, 4, 4, 9 };
+    Framebuffer<RGB8>          image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    std::vector<PixelPoint>    points;
+    std::vector<Point<double>> samples;
+    size_t                     segmentCounts[2];
+    double                     elapsedTimes[2];
+    PixelPoint                 origin;
+
+    printf("\n%d curves per run on a %ldx%ld image, %d fixed steps against a flatness of %g px\n\n", BENCHMARK_CURVE_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy, DEFAULT_STEPS[(int)ALGORITHM::BEZIER_SPLINE], BEZIER_FLATNESS);
+    printf("%10s %8s %12s %12s %14s %14s %8s\n", "Curve", "Span", "Fixed segs", "Fixed (ms)", "Adaptive segs", "Adaptive (ms)", "Speedup");
+
+    for (int curve = 0; curve < 4; ++curve)
+    {
+        for (int method = 0; method < 2; ++method)
+        {
+            std::mt19937                       randomEngine(2024);
+            std::uniform_int_distribution<int> xDistribution(0, BENCHMARK_SIZE.cx - curveSpans[curve]);
+            std::uniform_int_distribution<int> yDistribution(0, BENCHMARK_SIZE.cy - std::min(curveSpans[curve], BENCHMARK_SIZE.cy));
+            std::uniform_int_distribution<int> offsetDistribution(0, curveSpans[curve]);
+
+            image.Clear({ 255, 255, 255 });
+            segmentCounts[method] = 0;
+
+            std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+            for (int index = 0; index < BENCHMARK_CURVE_COUNT; ++index)
+            {
+                origin = { xDistribution(randomEngine), yDistribution(randomEngine) };
+                points.clear();
+
+                for (int point = 0; point < pointCounts[curve]; ++point)
+                    points.push_back({ origin.x + offsetDistribution(randomEngine), std::min(origin.y + offsetDistribution(randomEngine), BENCHMARK_SIZE.cy - 1) });
+
+                if (method == 0)
+                    TessellateBezier(samples, points, DEFAULT_STEPS[(int)ALGORITHM::BEZIER_SPLINE]);
+                else
+                    TessellateSpline(samples, points, SPLINE::BEZIER);
+
+                DrawSplineSamples(image, samples, { 0, 0, 0 });
+                segmentCounts[method] += samples.size() - 1;
+            }
+
+            elapsedTimes[method] = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+        }
+
+        printf("%10s %8ld %12zu %12.2f %14zu %14.2f %8.2f\n", curveNames[curve], (long)curveSpans[curve], segmentCounts[0], elapsedTimes[0], segmentCounts[1], elapsedTimes[1], elapsedTimes[0] / elapsedTimes[1]);
+    }
+}
+
+// Small curves of 2 to 8 points drawn one by one and then as a batch, which must give the same image.
+void BenchmarkSplineBatch(int maxThreadCount)
+{
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> countDistribution(2, 8);
+    std::uniform_int_distribution<int> xDistribution(0, BENCHMARK_SIZE.cx - 120);
+    std::uniform_int_distribution<int> yDistribution(0, BENCHMARK_SIZE.cy - 80);
+    Framebuffer<RGB8>                  referenceImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>                  image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    SplineBatch                        batch;
+    SegmentStream                      segments;
+    std::vector<SplineScratch>         scratches;
+    std::vector<PixelPoint>            points;
+    PixelPoint                         origin;
+    double                             tessellationTime = 0.0;
+    double                             referenceTime;
+
+    for (int curve = 0; curve < BENCHMARK_BATCH_COUNT; ++curve)
+    {
+        origin = { xDistribution(randomEngine), yDistribution(randomEngine) };
+        points.resize(countDistribution(randomEngine));
+
+        for (PixelPoint& point : points)
+            point = { origin.x + (coord_t)(randomEngine() % 120), origin.y + (coord_t)(randomEngine() % 80) };
+
+        batch.AddCurve(points.data(), points.size());
+    }
+
+    referenceImage.Clear({ 255, 255, 255 });
+
+    std::chrono::high_resolution_clock::time_point referenceStartTime = std::chrono::high_resolution_clock::now();
+
+    for (size_t curve = 0; curve < batch.GetCurveCount(); ++curve)
+    {
+        points.clear();
+
+        for (size_t index = batch.curveOffsets[curve]; index < batch.curveOffsets[curve + 1]; ++index)
+            points.push_back({ batch.pointXs[index], batch.pointYs[index] });
+
+        DrawSpline(referenceImage, points, batch.spline, BEZIER_FLATNESS, { 0, 0, 0 });
+    }
+
+    referenceTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - referenceStartTime).count();
+
+    printf("\n%d Bezier curves on a %ldx%ld image, one by one in %.2f ms\n\n", BENCHMARK_BATCH_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy, referenceTime);
+    printf("%10s %12s %12s %12s %8s %10s\n", "Threads", "Tess. (ms)", "Total (ms)", "Curves/s", "Speedup", "Identical");
+
+    image.Clear({ 255, 255, 255 });
+
+    MeasureThreadCounts(maxThreadCount, [&](int threadCount)
+    {
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        TessellateSplineBatch(segments, batch, BEZIER_FLATNESS, threadCount, scratches);
+
+        tessellationTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        DrawSegmentStream(image, segments, { 0, 0, 0 });
+    },
+    [&](int threadCount, double elapsedTime)
+    {
+        printf("%10d %12.2f %12.2f %12.4g %8.2f %10s\n", threadCount, tessellationTime, elapsedTime, BENCHMARK_BATCH_COUNT / elapsedTime * 1000.0, referenceTime / elapsedTime, (IsSameImage(image, referenceImage) == true) ? ("yes") : ("no"));
+        image.Clear({ 255, 255, 255 });
+    });
+}
+
+// Averages every factor x factor block of sampleImage into one pixel of image.
+void DownsampleImage(Framebuffer<RGB8>& image, const Framebuffer<RGB8>& sampleImage, int factor)
+{
+    int           sampleCount = factor * factor;
+    const byte_t* sample;
+    byte_t*       pixel;
+    int           sums[3];
+
+    for (coord_t y = 0; y < image.GetHeight(); ++y)
+        for (coord_t x = 0; x < image.GetWidth(); ++x)
+        {
+            sums[0] = sums[1] = sums[2] = 0;
+
+            for (int sampleY = 0; sampleY < factor; ++sampleY)
+            {
+                sample = sampleImage.GetData() + (size_t)(y * factor + sampleY) * sampleImage.GetStride() + (size_t)x * factor * 3;
+
+                for (int sampleX = 0; sampleX < factor * 3; sampleX += 3)
+                {
+                    sums[0] += sample[sampleX];
+                    sums[1] += sample[sampleX + 1];
+                    sums[2] += sample[sampleX + 2];
+                }
+            }
+
+            pixel = image.GetPixel(x, y);
+
+            for (int channel = 0; channel < 3; ++channel)
+                pixel[channel] = (byte_t)((sums[channel] + sampleCount / 2) / sampleCount);
+        }
+}
+
+// The same seeded solid lines drawn aliased, with Wu's coverage and supersampled at 2x2 and 4x4.
+void BenchmarkAntialiasing()
+{
+    const char*                        methodNames[4] = { "Aliased", "Wu", "SSAA 2x2", "SSAA 4x4" };
+    const int                          factors[4]     = { 1, 1, 2, 4 };
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> xDistribution(0, BENCHMARK_SIZE.cx - 1);
+    std::uniform_int_distribution<int> yDistribution(0, BENCHMARK_SIZE.cy - 1);
+    std::vector<PixelPoint>            startPoints;
+    std::vector<PixelPoint>            endPoints;
+    Framebuffer<RGB8>                  image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>                  sampleImage;
+    PixelColor                         color;
+    double                             elapsedTime;
+
+    for (int index = 0; index < BENCHMARK_PRIMITIVE_COUNT; ++index)
+    {
+        startPoints.push_back({ xDistribution(randomEngine), yDistribution(randomEngine) });
+        endPoints.push_back({ xDistribution(randomEngine), yDistribution(randomEngine) });
+    }
+
+    printf("\n%d lines on a %ldx%ld image\n\n", BENCHMARK_PRIMITIVE_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy);
+    printf("%10s %12s %12s\n", "Method", "Time (ms)", "Memory (MB)");
+
+    for (int method = 0; method < 4; ++method)
+    {
+        sampleImage.Resize(BENCHMARK_SIZE.cx * factors[method], BENCHMARK_SIZE.cy * factors[method]);
+
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        if (method == 1)
+            image.Clear({ 255, 255, 255 });
+        else
+            sampleImage.Clear({ 255, 255, 255 });
+
+        for (int index = 0; index < BENCHMARK_PRIMITIVE_COUNT; ++index)
+        {
+            color = { (byte_t)(index * 7), (byte_t)(index * 13), (byte_t)(index * 29) };
+
+            if (method == 1)
+                DrawWuLine(image, startPoints[index], endPoints[index], color, LINETYPE::SOLID);
+            else
+                DrawDDALine(sampleImage, { startPoints[index].x * factors[method], startPoints[index].y * factors[method] }, { endPoints[index].x * factors[method], endPoints[index].y * factors[method] }, color, LINETYPE::SOLID);
+        }
+
+        if (method != 1)
+            DownsampleImage(image, sampleImage, factors[method]);
+
+        elapsedTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        printf("%10s %12.2f %12.2f\n", methodNames[method], elapsedTime, BENCHMARK_SIZE.cx * factors[method] * BENCHMARK_SIZE.cy * factors[method] * 3 / 1048576.0);
+    }
+}
+
+// Floods the canvas from seedPoint and reports whether it escaped through a gap in the outline.
+bool IsOutlineOpen(Framebuffer<Gray8>& canvas, PixelPoint seedPoint, byte_t background)
+{
+    std::vector<PixelPoint> points;
+    PixelPoint              point;
+
+    if (*canvas.GetPixel(seedPoint.x, seedPoint.y) != background)
+        return false;
+
+    *canvas.GetPixel(seedPoint.x, seedPoint.y) = ~background;
+    points.push_back(seedPoint);
+
+    while (points.empty() == false)
+    {
+        point = points.back();
+        points.pop_back();
+
+        if (point.x == 0 || point.y == 0 || point.x == canvas.GetWidth() - 1 || point.y == canvas.GetHeight() - 1)
+            return true;
+
+        for (PixelPoint neighbour : { PixelPoint{ point.x + 1, point.y }, PixelPoint{ point.x - 1, point.y }, PixelPoint{ point.x, point.y + 1 }, PixelPoint{ point.x, point.y - 1 } })
+        {
+            if (*canvas.GetPixel(neighbour.x, neighbour.y) == background)
+            {
+                *canvas.GetPixel(neighbour.x, neighbour.y) = ~background;
+                points.push_back(neighbour);
+            }
+        }
+    }
+
+    return false;
+}
+
+// Times the rotated outlines before and after the conic tracer and counts the outlines left with gaps.
+void BenchmarkEllipses()
+{
+    const char*                        methodNames[2] = { "Trig", "Conic" };
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> xDistribution(-BENCHMARK_SIZE.cx / 2, BENCHMARK_SIZE.cx * 3 / 2);
+    std::uniform_int_distribution<int> yDistribution(-BENCHMARK_SIZE.cy / 2, BENCHMARK_SIZE.cy * 3 / 2);
+    std::uniform_int_distribution<int> sceneRadiusDistribution(1, BENCHMARK_SIZE.cy / 2);
+    std::uniform_int_distribution<int> radiusDistribution(2, 200);
+    std::uniform_int_distribution<int> angleDistribution(0, 359);
+    Framebuffer<RGB8>                  image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<Gray8>                 canvas;
+    PixelPoint                         centerPoint;
+    PixelSize                          radius;
+    PixelColor                         color;
+    coord_t                            canvasSize;
+    double                             elapsedTimes[2];
+    int                                openCounts[2] = { 0, 0 };
+    int                                theta;
+
+    for (int method = 0; method < 2; ++method)
+    {
+        randomEngine.seed(2024);
+        image.Clear({ 255, 255, 255 });
+
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        for (int index = 0; index < BENCHMARK_PRIMITIVE_COUNT; ++index)
+        {
+            centerPoint = { xDistribution(randomEngine), yDistribution(randomEngine) };
+            radius      = { sceneRadiusDistribution(randomEngine), sceneRadiusDistribution(randomEngine) };
+            color       = { (byte_t)index, (byte_t)(index >> 8), (byte_t)(index >> 16) };
+
+            if (method == 0)
+                DrawTrigonometricEllipse(image, centerPoint, radius, angleDistribution(randomEngine), color);
+            else
+                DrawEllipse(image, centerPoint, radius, angleDistribution(randomEngine), color);
+        }
+
+        elapsedTimes[method] = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+
+    randomEngine.seed(2024);
+
+    for (int index = 0; index < BENCHMARK_OUTLINE_COUNT; ++index)
+    {
+        radius     = { radiusDistribution(randomEngine), radiusDistribution(randomEngine) };
+        theta      = angleDistribution(randomEngine);
+        canvasSize = 2 * std::max(radius.cx, radius.cy) + 8;
+
+        canvas.Resize(canvasSize, canvasSize);
+
+        for (int method = 0; method < 2; ++method)
+        {
+            canvas.Clear(255);
+
+            if (method == 0)
+                DrawTrigonometricEllipse(canvas, { canvasSize / 2, canvasSize / 2 }, radius, theta, (byte_t)0);
+            else
+                DrawEllipse(canvas, { canvasSize / 2, canvasSize / 2 }, radius, theta, (byte_t)0);
+
+            openCounts[method] += (IsOutlineOpen(canvas, { canvasSize / 2, canvasSize / 2 }, 255) == true) ? (1) : (0);
+        }
+    }
+
+    printf("\n%d ellipses per run on a %ldx%ld image, %d more flooded on their own\n\n", BENCHMARK_PRIMITIVE_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy, BENCHMARK_OUTLINE_COUNT);
+    printf("%10s %12s %8s %10s\n", "Method", "Time (ms)", "Speedup", "Open");
+
+    for (int method = 0; method < 2; ++method)
+        printf("%10s %12.2f %8.2f %10d\n", methodNames[method], elapsedTimes[method], elapsedTimes[0] / elapsedTimes[method], openCounts[method]);
+}
+
+// Seeded lines of up to 65536 pixels drawn with the float DDA, the fixed-point DDA and the exact reference.
+void BenchmarkDDALines()
+{
+    const char*                        setNames[4]   = { "Short", "Medium", "Long", "Huge" };
+    const int                          lengths[4]    = { 8, 100, 1000, 65535 };
+    const int                          lineCounts[4] = { BENCHMARK_DDA_COUNT, BENCHMARK_DDA_COUNT, BENCHMARK_DDA_COUNT / 10, BENCHMARK_DDA_COUNT / 100 };
+    std::mt19937                       randomEngine(2024);
+    Framebuffer<RGB8>                  referenceImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>                  floatImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>                  image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    std::vector<PixelPoint>            startPoints;
+    std::vector<PixelPoint>            endPoints;
+    std::vector<PixelColor>            colors;
+    double                             floatTime;
+    double                             elapsedTime;
+    long long                          floatErrorCount;
+
+    printf("\nLines on a %ldx%ld image, up to the given length along each axis\n\n", (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy);
+    printf("%10s %8s %12s %12s %12s %12s %8s %12s %10s\n", "Set", "Lines", "Float (ms)", "Fixed (ms)", "Float/s", "Fixed/s", "Speedup", "Float off", "Exact");
+
+    for (int set = 0; set < 4; ++set)
+    {
+        std::uniform_int_distribution<int> xDistribution(BENCHMARK_SIZE.cx / 2 - std::max(lengths[set], BENCHMARK_SIZE.cx), BENCHMARK_SIZE.cx / 2 + std::max(lengths[set], BENCHMARK_SIZE.cx));
+        std::uniform_int_distribution<int> yDistribution(BENCHMARK_SIZE.cy / 2 - std::max(lengths[set], BENCHMARK_SIZE.cy), BENCHMARK_SIZE.cy / 2 + std::max(lengths[set], BENCHMARK_SIZE.cy));
+        std::uniform_int_distribution<int> offsetDistribution(-lengths[set], lengths[set]);
+
+        startPoints.clear();
+        endPoints.clear();
+        colors.clear();
+
+        for (int index = 0; index < lineCounts[set]; ++index)
+        {
+            startPoints.push_back({ xDistribution(randomEngine), yDistribution(randomEngine) });
+            endPoints.push_back({ startPoints.back().x + offsetDistribution(randomEngine), startPoints.back().y + offsetDistribution(randomEngine) });
+            colors.push_back({ (byte_t)index, (byte_t)(index >> 8), (byte_t)(index >> 16) });
+        }
+
+        referenceImage.Clear({ 255, 255, 255 });
+        floatImage.Clear({ 255, 255, 255 });
+        image.Clear({ 255, 255, 255 });
+
+        for (size_t index = 0; index < startPoints.size(); ++index)
+            DrawCheckedDDALine(referenceImage, startPoints[index], endPoints[index], colors[index], LINETYPE::SOLID);
+
+        std::chrono::high_resolution_clock::time_point floatStartTime = std::chrono::high_resolution_clock::now();
+
+        for (size_t index = 0; index < startPoints.size(); ++index)
+            DrawFloatDDALine(floatImage, startPoints[index], endPoints[index], colors[index], LINETYPE::SOLID);
+
+        floatTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - floatStartTime).count();
+
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        for (size_t index = 0; index < startPoints.size(); ++index)
+            DrawDDALine(image, startPoints[index], endPoints[index], colors[index], LINETYPE::SOLID);
+
+        elapsedTime     = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+        floatErrorCount = 0;
+
+        for (size_t offset = 0; offset < floatImage.GetByteCount(); offset += 3)
+            floatErrorCount += (memcmp(floatImage.GetData() + offset, referenceImage.GetData() + offset, 3) != 0) ? (1) : (0);
+
+        printf("%10s %8d %12.2f %12.2f %12.4g %12.4g %8.2f %12lld %10s\n", setNames[set], lineCounts[set], floatTime, elapsedTime, lineCounts[set] / floatTime * 1000.0, lineCounts[set] / elapsedTime * 1000.0, floatTime / elapsedTime, floatErrorCount, (memcmp(image.GetData(), referenceImage.GetData(), image.GetByteCount()) == 0) ? ("yes") : ("no"));
+    }
+}
+
+// Seeded wireframe lines, a quarter dashed or dotted, drawn pixel by pixel and then by slices and as a batch.
+void BenchmarkBresenhamLines()
+{
+    const char*                        setNames[3] = { "Flat", "Steep", "Any" };
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> xDistribution(-100, BENCHMARK_SIZE.cx + 100);
+    std::uniform_int_distribution<int> yDistribution(-100, BENCHMARK_SIZE.cy + 100);
+    std::uniform_int_distribution<int> majorDistribution(-400, 400);
+    std::uniform_int_distribution<int> minorDistribution(-25, 25);
+    Framebuffer<RGB8>                  referenceImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>                  image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    std::vector<PixelPoint>            startPoints(BENCHMARK_WIREFRAME_COUNT);
+    std::vector<PixelPoint>            endPoints(BENCHMARK_WIREFRAME_COUNT);
+    PixelSize                          offset;
+    double                             steppedTime;
+    double                             elapsedTime;
+    size_t                             solidCount = BENCHMARK_WIREFRAME_COUNT * 3 / 4;
+
+    printf("\n%d lines per set on a %ldx%ld image, the last quarter of them dashed and dotted\n\n", BENCHMARK_WIREFRAME_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy);
+    printf("%10s %12s %12s %8s %10s\n", "Set", "Steps (ms)", "Slices (ms)", "Speedup", "Identical");
+
+    for (int set = 0; set < 3; ++set)
+    {
+        for (int index = 0; index < BENCHMARK_WIREFRAME_COUNT; ++index)
+        {
+            offset             = { majorDistribution(randomEngine), (set == 2) ? (majorDistribution(randomEngine)) : (minorDistribution(randomEngine)) };
+            startPoints[index] = { xDistribution(randomEngine), yDistribution(randomEngine) };
+            endPoints[index]   = (set == 1) ? (PixelPoint{ startPoints[index].x + offset.cy, startPoints[index].y + offset.cx }) : (PixelPoint{ startPoints[index].x + offset.cx, startPoints[index].y + offset.cy });
+        }
+
+        referenceImage.Clear({ 255, 255, 255 });
+
+        std::chrono::high_resolution_clock::time_point steppedStartTime = std::chrono::high_resolution_clock::now();
+
+        for (size_t index = 0; index < startPoints.size(); ++index)
+            DrawSteppedBresenhamLine(referenceImage, startPoints[index], endPoints[index], { 0, 0, 0 }, (index < solidCount) ? (LINETYPE::SOLID) : ((LINETYPE)(1 + index % 2)));
+
+        steppedTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - steppedStartTime).count();
+
+        image.Clear({ 255, 255, 255 });
+
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        DrawBresenhamLines(image, startPoints.data(), endPoints.data(), solidCount, { 0, 0, 0 }, LINETYPE::SOLID);
+
+        for (size_t index = solidCount; index < startPoints.size(); ++index)
+            DrawBresenhamLine(image, startPoints[index], endPoints[index], { 0, 0, 0 }, (LINETYPE)(1 + index % 2));
+
+        elapsedTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        printf("%10s %12.2f %12.2f %8.2f %10s\n", setNames[set], steppedTime, elapsedTime, steppedTime / elapsedTime, (memcmp(image.GetData(), referenceImage.GetData(), image.GetByteCount()) == 0) ? ("yes") : ("no"));
+    }
+}
+
+// Fills a shape the way it would be done without spans: an inside test for every pixel of its bounding box.
+void FillShapeByPixels(Framebuffer<RGB8>& image, const ShapeBatch<RGB8>& batch, size_t index)
+{
+    PixelPoint   centerPoint   = batch.centerPoints[index];
+    PixelSize    radius        = batch.radii[index];
+    float        radian        = batch.thetas[index] * 3.141592F / 180.0F;
+    double       cosine        = cos(radian);
+    double       sine          = sin(radian);
+    Size<double> squaredRadius = { (double)radius.cx * radius.cx, (double)radius.cy * radius.cy };
+    coord_t      extent        = std::max(radius.cx, radius.cy);
+    double       localX;
+    double       localY;
+
+    for (coord_t y = centerPoint.y - extent; y <= centerPoint.y + extent; ++y)
+        for (coord_t x = centerPoint.x - extent; x <= centerPoint.x + extent; ++x)
+        {
+            localX = (x - centerPoint.x) * cosine + (y - centerPoint.y) * sine;
+            localY = (y - centerPoint.y) * cosine - (x - centerPoint.x) * sine;
+
+            if (localX * localX * squaredRadius.cy + localY * localY * squaredRadius.cx <= squaredRadius.cx * squaredRadius.cy)
+                SetPixel(image, { x, y }, batch.colors[index]);
+        }
+}
+
+// Seeded discs and ellipses, partly off the image, filled by per-pixel inside tests and then by spans.
+void BenchmarkFilledShapes(int maxThreadCount)
+{
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> xDistribution(-50, BENCHMARK_SIZE.cx + 50);
+    std::uniform_int_distribution<int> yDistribution(-50, BENCHMARK_SIZE.cy + 50);
+    std::uniform_int_distribution<int> radiusDistribution(1, 100);
+    std::uniform_int_distribution<int> angleDistribution(0, 359);
+    Framebuffer<RGB8>                  referenceImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>                  image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    ShapeBatch<RGB8>                   batch;
+    PixelColor                         color;
+    double                             pixelTime;
+
+    for (int index = 0; index < BENCHMARK_SHAPE_COUNT; ++index)
+    {
+        color = { (byte_t)(index * 7), (byte_t)(index * 13), (byte_t)(index * 29) };
+
+        if (index % 2 == 0)
+            batch.AddCircle({ xDistribution(randomEngine), yDistribution(randomEngine) }, radiusDistribution(randomEngine), color);
+        else
+            batch.AddEllipse({ xDistribution(randomEngine), yDistribution(randomEngine) }, { radiusDistribution(randomEngine), radiusDistribution(randomEngine) }, angleDistribution(randomEngine), color);
+    }
+
+    image.Clear({ 255, 255, 255 });
+
+    std::chrono::high_resolution_clock::time_point pixelStartTime = std::chrono::high_resolution_clock::now();
+
+    for (size_t index = 0; index < batch.GetCount(); ++index)
+        FillShapeByPixels(image, batch, index);
+
+    pixelTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - pixelStartTime).count();
+
+    printf("\n%d filled circles and ellipses on a %ldx%ld image, by per-pixel inside tests in %.2f ms\n\n", BENCHMARK_SHAPE_COUNT, (long)BENCHMARK_SIZE.cx, (long)BENCHMARK_SIZE.cy, pixelTime);
+    printf("%10s %12s %12s %8s %10s\n", "Threads", "Time (ms)", "Shapes/s", "Speedup", "Identical");
+
+    image.Clear({ 255, 255, 255 });
+
+    MeasureThreadCounts(maxThreadCount, [&](int threadCount)
+    {
+        FillShapeBatch(image, batch, threadCount);
+    },
+    [&](int threadCount, double elapsedTime)
+    {
+        if (threadCount == 1)
+            memcpy(referenceImage.GetData(), image.GetData(), image.GetByteCount());
+
+        printf("%10d %12.2f %12.4g %8.2f %10s\n", threadCount, elapsedTime, BENCHMARK_SHAPE_COUNT / elapsedTime * 1000.0, pixelTime / elapsedTime, (IsSameImage(image, referenceImage) == true) ? ("yes") : ("no"));
+        image.Clear({ 255, 255, 255 });
+    });
+}
+
+// Scattered primitives on an image far larger than the caches, drawn one by one and then through a command buffer.
+void BenchmarkCommandBuffer(int maxThreadCount)
+{
+    std::mt19937                       randomEngine(2024);
+    std::uniform_int_distribution<int> xDistribution(-100, BENCHMARK_COMMAND_SIZE.cx + 100);
+    std::uniform_int_distribution<int> yDistribution(-100, BENCHMARK_COMMAND_SIZE.cy + 100);
+    std::uniform_int_distribution<int> offsetDistribution(-200, 200);
+    std::uniform_int_distribution<int> radiusDistribution(0, 100);
+    std::uniform_int_distribution<int> angleDistribution(0, 359);
+    Framebuffer<RGB8>                  referenceImage(BENCHMARK_COMMAND_SIZE.cx, BENCHMARK_COMMAND_SIZE.cy);
+    Framebuffer<RGB8>                  image(BENCHMARK_COMMAND_SIZE.cx, BENCHMARK_COMMAND_SIZE.cy);
+    CommandBuffer<RGB8>                buffer;
+    PixelPoint                         point;
+    PixelColor                         color;
+    double                             immediateTime;
+
+    for (int index = 0; index < BENCHMARK_COMMAND_COUNT; ++index)
+    {
+        point = { xDistribution(randomEngine), yDistribution(randomEngine) };
+        color = { (byte_t)(index * 7), (byte_t)(index * 13), (byte_t)(index * 29) };
+
+        switch (index % 4)
+        {
+        case 0:
+            buffer.AddDDALine(point, { point.x + offsetDistribution(randomEngine), point.y + offsetDistribution(randomEngine) }, color, (LINETYPE)(index / 4 % 3));
+            break;
+
+        case 1:
+            buffer.AddBresenhamLine(point, { point.x + offsetDistribution(randomEngine), point.y + offsetDistribution(randomEngine) }, color, (LINETYPE)(index / 4 % 3));
+            break;
+
+        case 2:
+            buffer.AddCircle(point, radiusDistribution(randomEngine), color);
+            break;
+
+        default:
+            buffer.AddEllipse(point, { radiusDistribution(randomEngine), radiusDistribution(randomEngine) }, angleDistribution(randomEngine), color);
+            break;
+        }
+    }
+
+    referenceImage.Clear({ 255, 255, 255 });
+
+    std::chrono::high_resolution_clock::time_point immediateStartTime = std::chrono::high_resolution_clock::now();
+
+    for (size_t index = 0; index < buffer.GetCount(); ++index)
+        ExecuteCommand(referenceImage, buffer, index, { 0, 0 });
+
+    immediateTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - immediateStartTime).count();
+
+    printf("\n%d lines, circles and ellipses on a %ldx%ld image, drawn one by one in %.2f ms\n\n", BENCHMARK_COMMAND_COUNT, (long)BENCHMARK_COMMAND_SIZE.cx, (long)BENCHMARK_COMMAND_SIZE.cy, immediateTime);
+    printf("%10s %12s %12s %8s %10s\n", "Threads", "Time (ms)", "Commands/s", "Speedup", "Identical");
+
+    image.Clear({ 255, 255, 255 });
+
+    MeasureThreadCounts(maxThreadCount, [&](int threadCount)
+    {
+        ExecuteCommandBuffer(image, buffer, threadCount);
+    },
+    [&](int threadCount, double elapsedTime)
+    {
+        printf("%10d %12.2f %12.4g %8.2f %10s\n", threadCount, elapsedTime, BENCHMARK_COMMAND_COUNT / elapsedTime * 1000.0, immediateTime / elapsedTime, (IsSameImage(image, referenceImage) == true) ? ("yes") : ("no"));
+        image.Clear({ 255, 255, 255 });
+    });
+}
+
+void PrintUsage(const char* programName)
+{
+    printf("Usage: %s <job file> [--threads N]\n", programName);
+    printf("       %s --gallery <width> <height> <directory> [--threads N]\n", programName);
+    printf("       %s --benchmark [--threads N]\n\n", programName);
+    printf("Each line of a job file is an algorithm followed by key=value pairs:\n");
+    printf("    mandelbrot size=2000x2000 center=-0.745,0.1 viewport=0.01,0.01 output=\"Deep Zoom.pgm\"\n\n");
+    printf("Algorithms:");
+
+    for (int index = 0; index < ALGORITHM_COUNT; ++index)
+        printf(" %s", ALGORITHM_NAMES[index]);
+
+    printf("\nKeys: size=WxH, output=path, steps=N\n");
+    printf("      seed=N (random-tree, gasket, ifs), shading=binary|density (gasket)\n");
+    printf("      system=fern|carpet|triangle, maps=a,b,c,d,e,f,weight,... and bounds=left,bottom,right,top (ifs)\n");
+    printf("      points=x1,y1,x2,y2,..., spline=bezier|bspline|catmull-rom and flatness=px (bezier, adaptive if set)\n");
+    printf("      lines=aliased|antialiased (koch, normal-tree, random-tree, bezier)\n");
+    printf("      center=re,im and viewport=w,h (mandelbrot)\n");
+    printf("Scene coordinates, bezier points included, are given for a %ldx%ld image and scaled to size.\n", (long)REFERENCE_SIZE.cx, (long)REFERENCE_SIZE.cy);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<RenderJob> jobs;
+    int                    threadCount   = GetThreadCount();
+    int                    argumentCount = argc;
+
+    for (int index = 1; index + 1 < argc; ++index)
+        if (strcmp(argv[index], "--threads") == 0)
+        {
+            threadCount   = std::max(1, atoi(argv[index + 1]));
+            argumentCount = index;
+        }
+
+    if (argumentCount == 2 && strcmp(argv[1], "--benchmark") == 0)
+    {
+        BenchmarkPrimitives();
+        BenchmarkEllipses();
+        BenchmarkDDALines();
+        BenchmarkBresenhamLines();
+        BenchmarkAntialiasing();
+        BenchmarkChaosGame(threadCount);
+        BenchmarkIFS(threadCount);
+        BenchmarkBezier();
+        BenchmarkSplineBatch(threadCount);
+        BenchmarkFilledShapes(threadCount);
+        BenchmarkCommandBuffer(threadCount);
+        return 0;
+    }
+
+    if (argumentCount == 5 && strcmp(argv[1], "--gallery") == 0 && atoi(argv[2]) > 0 && atoi(argv[3]) > 0)
+        jobs = CreateGalleryJobs({ atoi(argv[2]), atoi(argv[3]) }, argv[4]);
+    else if (argumentCount == 2 && strncmp(argv[1], "--", 2) != 0)
+    {
+        if (ReadJobs(argv[1], jobs) == false)
+            return 1;
+    }
+    else
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return (RunJobs(jobs, threadCount) == true) ? (0) : (1);
+}
\ No newline at end of file
@@ -0,0 +1,479 @@
+#pragma once
+
+#include "Wu Line.h"
+
+#include <vector>
+
+// Curves up to this degree are walked by forward differences, re-seeded every BEZIER_FORWARD_DIFFERENCE_SPAN samples.
+static const int BEZIER_FORWARD_DIFFERENCE_DEGREE = 3;
+static const int BEZIER_FORWARD_DIFFERENCE_SPAN   = 256;
+
+// Up to this degree a point is a Horner sum over the binomial row, past it de Casteljau's construction is used.
+static const int BEZIER_HORNER_DEGREE = 20;
+
+// Adaptive tessellation halves a curve until each piece is within BEZIER_FLATNESS pixels of its chord, at most this deep.
+static const double BEZIER_FLATNESS          = 0.25;
+static const int    BEZIER_SUBDIVISION_DEPTH = 16;
+
+// The uniform splines repeat their end points so they start at the first point and end at the last.
+enum class SPLINE
+{
+    BEZIER      = 0,
+    BSPLINE     = 1,
+    CATMULL_ROM = 2
+};
+
+// Row degree of Pascal's triangle. Every entry is an exact integer while it stays below 2^53, which holds to degree 56.
+inline std::vector<double>& CreateBinomialRow(std::vector<double>& row, int degree)
+{
+    row.resize(degree + 1);
+    row[0] = 1.0;
+
+    for (int index = 1; index <= degree; ++index)
+        row[index] = row[index - 1] * (degree - index + 1) / index;
+
+    return row;
+}
+
+// Horner's rule in t / (1 - t), or in (1 - t) / t past the middle, so the ratio never exceeds 1.
+inline Point<double> EvaluateBezierHorner(const PixelPoint* points, const double* binomials, int degree, double t)
+{
+    Point<double> sum;
+    double        ratio;
+    double        scale = 1.0;
+
+    if (t <= 0.5)
+    {
+        ratio = t / (1.0 - t);
+        sum   = { binomials[degree] * points[degree].x, binomials[degree] * points[degree].y };
+
+        for (int index = degree - 1; index >= 0; --index)
+        {
+            sum    = { sum.x * ratio + binomials[index] * points[index].x, sum.y * ratio + binomials[index] * points[index].y };
+            scale *= 1.0 - t;
+        }
+    }
+    else
+    {
+        ratio = (1.0 - t) / t;
+        sum   = { binomials[0] * points[0].x, binomials[0] * points[0].y };
+
+        for (int index = 1; index <= degree; ++index)
+        {
+            sum    = { sum.x * ratio + binomials[index] * points[index].x, sum.y * ratio + binomials[index] * points[index].y };
+            scale *= t;
+        }
+    }
+
+    return { sum.x * scale, sum.y * scale };
+}
+
+// Costs count^2 / 2 steps but stays accurate at any degree. scratch must hold count points.
+inline Point<double> EvaluateBezierDeCasteljau(const PixelPoint* points, int count, double t, Point<double>* scratch)
+{
+    for (int index = 0; index < count; ++index)
+        scratch[index] = { (double)points[index].x, (double)points[index].y };
+
+    for (int level = count - 1; level > 0; --level)
+        for (int index = 0; index < level; ++index)
+            scratch[index] = { (1.0 - t) * scratch[index].x + t * scratch[index + 1].x, (1.0 - t) * scratch[index].y + t * scratch[index + 1].y };
+
+    return scratch[0];
+}
+
+// Fills samples firstStep to lastStep from differences of the exact points at firstStep to firstStep + degree.
+inline void ForwardDifferenceBezier(Point<double>* samples, const PixelPoint* points, const double* binomials, int degree, int steps, int firstStep, int lastStep)
+{
+    Point<double> differences[BEZIER_FORWARD_DIFFERENCE_DEGREE + 1];
+
+    for (int index = 0; index <= degree; ++index)
+        differences[index] = EvaluateBezierHorner(points, binomials, degree, (double)(firstStep + index) / steps);
+
+    for (int order = 1; order <= degree; ++order)
+        for (int index = degree; index >= order; --index)
+            differences[index] = { differences[index].x - differences[index - 1].x, differences[index].y - differences[index - 1].y };
+
+    for (int step = firstStep; step <= lastStep; ++step)
+    {
+        samples[step] = differences[0];
+
+        for (int index = 0; index < degree; ++index)
+            differences[index] = { differences[index].x + differences[index + 1].x, differences[index].y + differences[index + 1].y };
+    }
+}
+
+// Samples the curve at t = step / steps for step 0 to steps. The ends are set to the end points exactly.
+inline std::vector<Point<double>>& TessellateBezier(std::vector<Point<double>>& samples, const std::vector<PixelPoint>& points, int steps)
+{
+    int                        degree = (int)points.size() - 1;
+    std::vector<double>        binomials;
+    std::vector<Point<double>> scratch;
+
+    samples.clear();
+    EXECUTION_CONDITION(points.empty() == false && steps > 0, samples);
+
+    samples.resize(steps + 1);
+
+    if (degree <= BEZIER_HORNER_DEGREE)
+        CreateBinomialRow(binomials, degree);
+    else
+        scratch.resize(points.size());
+
+    if (degree <= BEZIER_FORWARD_DIFFERENCE_DEGREE)
+    {
+        for (int step = 0; step <= steps; step += BEZIER_FORWARD_DIFFERENCE_SPAN)
+            ForwardDifferenceBezier(samples.data(), points.data(), binomials.data(), degree, steps, step, std::min(step + BEZIER_FORWARD_DIFFERENCE_SPAN - 1, steps));
+    }
+    else if (degree <= BEZIER_HORNER_DEGREE)
+    {
+        for (int step = 0; step <= steps; ++step)
+            samples[step] = EvaluateBezierHorner(points.data(), binomials.data(), degree, (double)step / steps);
+    }
+    else
+    {
+        for (int step = 0; step <= steps; ++step)
+            samples[step] = EvaluateBezierDeCasteljau(points.data(), (int)points.size(), (double)step / steps, scratch.data());
+    }
+
+    samples.front() = { (double)points.front().x, (double)points.front().y };
+    samples.back()  = { (double)points.back().x, (double)points.back().y };
+
+    return samples;
+}
+
+// Splits the curve at t = 0.5 by de Casteljau's construction. right may be the same array as points.
+inline void SplitBezier(const Point<double>* points, int count, Point<double>* left, Point<double>* right)
+{
+    if (right != points)
+        std::copy(points, points + count, right);
+
+    for (int level = 0; level < count; ++level)
+    {
+        left[level] = right[0];
+
+        for (int index = 0; index < count - 1 - level; ++index)
+            right[index] = { (right[index].x + right[index + 1].x) * 0.5, (right[index].y + right[index + 1].y) * 0.5 };
+    }
+}
+
+// The curve lies in its control points' hull, so it is flat once the inner ones are within tolerance of the chord.
+inline bool IsBezierFlat(const Point<double>* points, int count, double squaredTolerance)
+{
+    Point<double> chord         = { points[count - 1].x - points[0].x, points[count - 1].y - points[0].y };
+    double        squaredLength = chord.x * chord.x + chord.y * chord.y;
+    Point<double> offset;
+    double        ratio;
+
+    for (int index = 1; index < count - 1; ++index)
+    {
+        offset = { points[index].x - points[0].x, points[index].y - points[0].y };
+        ratio  = (squaredLength > 0.0) ? (std::min(std::max((offset.x * chord.x + offset.y * chord.y) / squaredLength, 0.0), 1.0)) : (0.0);
+        offset = { offset.x - ratio * chord.x, offset.y - ratio * chord.y };
+
+        EXECUTION_CONDITION(offset.x * offset.x + offset.y * offset.y <= squaredTolerance, false);
+    }
+
+    return true;
+}
+
+// Rounded segments in drawing order, ready for the line rasteriser.
+struct SegmentStream
+{
+    std::vector<PixelPoint> startPoints;
+    std::vector<PixelPoint> endPoints;
+
+    size_t GetCount() const
+    {
+        return startPoints.size();
+    }
+
+    // Keeps the capacity, so a stream that is refilled every frame stops allocating once it has grown.
+    void Clear()
+    {
+        startPoints.clear();
+        endPoints.clear();
+    }
+};
+
+// Working memory reused from curve to curve, cleared but never shrunk.
+struct SplineScratch
+{
+    std::vector<Point<double>> controlPoints;
+    std::vector<Point<double>> bezierPoints;
+    std::vector<Point<double>> pieces;
+    std::vector<int>           depths;
+    std::vector<Point<double>> samples;
+    SegmentStream              segments;
+};
+
+// Appends the end point of every flat piece in curve order; the start point is left to the caller.
+inline void SubdivideBezier(std::vector<Point<double>>& samples, const Point<double>* points, int count, double tolerance, SplineScratch& scratch)
+{
+    std::vector<Point<double>>& pieces = scratch.pieces;
+    std::vector<int>&           depths = scratch.depths;
+    Point<double>*              piece;
+    int                         depth;
+
+    pieces.reserve((size_t)count * (BEZIER_SUBDIVISION_DEPTH + 2));
+    pieces.assign(points, points + count);
+    depths.assign(1, 0);
+
+    while (depths.empty() == false)
+    {
+        depth = depths.back();
+        piece = pieces.data() + pieces.size() - count;
+
+        if (depth >= BEZIER_SUBDIVISION_DEPTH || IsBezierFlat(piece, count, tolerance * tolerance) == true)
+        {
+            samples.push_back(piece[count - 1]);
+            pieces.resize(pieces.size() - count);
+            depths.pop_back();
+            continue;
+        }
+
+        pieces.resize(pieces.size() + count);
+        piece = pieces.data() + pieces.size() - 2 * count;
+
+        SplitBezier(piece, count, piece + count, piece);
+
+        depths.back() = depth + 1;
+        depths.push_back(depth + 1);
+    }
+}
+
+// Converts a composite spline to 3 * pieces + 1 cubic Bezier points, clamping indices to repeat the ends.
+inline std::vector<Point<double>>& CreateCompositeBezier(std::vector<Point<double>>& bezierPoints, const Point<double>* points, size_t count, SPLINE spline)
+{
+    int           padding = (spline == SPLINE::BSPLINE) ? (2) : (1);
+    Point<double> window[4];
+
+    bezierPoints.clear();
+    EXECUTION_CONDITION(count >= 2, bezierPoints);
+
+    for (size_t index = 0; index + 3 < count + 2 * padding; ++index)
+    {
+        for (int offset = 0; offset < 4; ++offset)
+            window[offset] = points[std::min((size_t)std::max((long long)(index + offset) - padding, 0LL), count - 1)];
+
+        if (spline == SPLINE::BSPLINE)
+        {
+            if (index == 0)
+                bezierPoints.push_back({ (window[0].x + 4.0 * window[1].x + window[2].x) / 6.0, (window[0].y + 4.0 * window[1].y + window[2].y) / 6.0 });
+
+            bezierPoints.push_back({ (2.0 * window[1].x + window[2].x) / 3.0, (2.0 * window[1].y + window[2].y) / 3.0 });
+            bezierPoints.push_back({ (window[1].x + 2.0 * window[2].x) / 3.0, (window[1].y + 2.0 * window[2].y) / 3.0 });
+            bezierPoints.push_back({ (window[1].x + 4.0 * window[2].x + window[3].x) / 6.0, (window[1].y + 4.0 * window[2].y + window[3].y) / 6.0 });
+        }
+        else
+        {
+            if (index == 0)
+                bezierPoints.push_back(window[1]);
+
+            bezierPoints.push_back({ window[1].x + (window[2].x - window[0].x) / 6.0, window[1].y + (window[2].y - window[0].y) / 6.0 });
+            bezierPoints.push_back({ window[2].x - (window[3].x - window[1].x) / 6.0, window[2].y - (window[3].y - window[1].y) / 6.0 });
+            bezierPoints.push_back(window[2]);
+        }
+    }
+
+    return bezierPoints;
+}
+
+// Appends the samples of the spline through scratch.controlPoints, its first point included.
+inline void AppendSplineSamples(std::vector<Point<double>>& samples, SPLINE spline, double tolerance, SplineScratch& scratch)
+{
+    const std::vector<Point<double>>& points = scratch.controlPoints;
+
+    if (points.empty() == true)
+        return;
+
+    samples.push_back(points.front());
+
+    if (spline == SPLINE::BEZIER)
+        SubdivideBezier(samples, points.data(), (int)points.size(), tolerance, scratch);
+    else
+    {
+        CreateCompositeBezier(scratch.bezierPoints, points.data(), points.size(), spline);
+
+        for (size_t index = 0; index + 3 < scratch.bezierPoints.size(); index += 3)
+            SubdivideBezier(samples, scratch.bezierPoints.data() + index, 4, tolerance, scratch);
+    }
+}
+
+// A BEZIER spline is one curve of any degree; the others are split into their cubic pieces first.
+inline std::vector<Point<double>>& TessellateSpline(std::vector<Point<double>>& samples, const std::vector<PixelPoint>& points, SPLINE spline, double tolerance = BEZIER_FLATNESS)
+{
+    SplineScratch scratch;
+
+    for (const PixelPoint& point : points)
+        scratch.controlPoints.push_back({ (double)point.x, (double)point.y });
+
+    samples.clear();
+    AppendSplineSamples(samples, spline, tolerance, scratch);
+
+    return samples;
+}
+
+// Curve n owns the control points from curveOffsets[n] up to curveOffsets[n + 1].
+struct SplineBatch
+{
+    SPLINE               spline;
+    std::vector<coord_t> pointXs;
+    std::vector<coord_t> pointYs;
+    std::vector<size_t>  curveOffsets;
+
+    SplineBatch(SPLINE spline = SPLINE::BEZIER) : spline(spline), curveOffsets(1, 0)
+    {
+    }
+
+    size_t GetCurveCount() const
+    {
+        return curveOffsets.size() - 1;
+    }
+
+    void AddCurve(const PixelPoint* points, size_t count)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            pointXs.push_back(points[index].x);
+            pointYs.push_back(points[index].y);
+        }
+
+        curveOffsets.push_back(pointXs.size());
+    }
+
+    void Clear()
+    {
+        pointXs.clear();
+        pointYs.clear();
+        curveOffsets.assign(1, 0);
+    }
+};
+
+// Curves are handed out to the workers SPLINE_BATCH_TASK_SIZE at a time.
+static const size_t SPLINE_BATCH_TASK_SIZE = 256;
+
+// Workers append to streams of their own, merged in task order so the result stays in curve order.
+inline SegmentStream& TessellateSplineBatch(SegmentStream& segments, const SplineBatch& batch, double tolerance, int threadCount, std::vector<SplineScratch>& scratches)
+{
+    int                                          taskCount   = (int)((batch.GetCurveCount() + SPLINE_BATCH_TASK_SIZE - 1) / SPLINE_BATCH_TASK_SIZE);
+    int                                          workerCount = std::max(1, std::min(threadCount, taskCount));
+    std::vector<std::tuple<int, size_t, size_t>> taskRanges(taskCount);
+    size_t                                       segmentCount = 0;
+
+    segments.Clear();
+    EXECUTION_CONDITION(taskCount > 0, segments);
+
+    if ((int)scratches.size() < workerCount)
+        scratches.resize(workerCount);
+
+    for (SplineScratch& scratch : scratches)
+        scratch.segments.Clear();
+
+    RunParallelTasks(taskCount, workerCount, [&](int worker, int task)
+    {
+        SplineScratch& scratch     = scratches[worker];
+        size_t         firstCurve  = task * SPLINE_BATCH_TASK_SIZE;
+        size_t         lastCurve   = std::min(firstCurve + SPLINE_BATCH_TASK_SIZE, batch.GetCurveCount());
+        size_t         firstOutput = scratch.segments.GetCount();
+        PixelPoint     startPoint;
+        PixelPoint     endPoint;
+
+        for (size_t curve = firstCurve; curve < lastCurve; ++curve)
+        {
+            scratch.controlPoints.clear();
+
+            for (size_t index = batch.curveOffsets[curve]; index < batch.curveOffsets[curve + 1]; ++index)
+                scratch.controlPoints.push_back({ (double)batch.pointXs[index], (double)batch.pointYs[index] });
+
+            scratch.samples.clear();
+            AppendSplineSamples(scratch.samples, batch.spline, tolerance, scratch);
+
+            for (size_t index = 1; index < scratch.samples.size(); ++index)
+            {
+                startPoint = { (coord_t)(scratch.samples[index - 1].x + 0.5), (coord_t)(scratch.samples[index - 1].y + 0.5) };
+                endPoint   = { (coord_t)(scratch.samples[index].x + 0.5), (coord_t)(scratch.samples[index].y + 0.5) };
+
+                scratch.segments.startPoints.push_back(startPoint);
+                scratch.segments.endPoints.push_back(endPoint);
+            }
+        }
+
+        taskRanges[task] = std::make_tuple(worker, firstOutput, scratch.segments.GetCount() - firstOutput);
+    });
+
+    for (const std::tuple<int, size_t, size_t>& taskRange : taskRanges)
+        segmentCount += std::get<2>(taskRange);
+
+    segments.startPoints.resize(segmentCount);
+    segments.endPoints.resize(segmentCount);
+    segmentCount = 0;
+
+    for (const std::tuple<int, size_t, size_t>& taskRange : taskRanges)
+    {
+        const SegmentStream& taskSegments = scratches[std::get<0>(taskRange)].segments;
+
+        std::copy_n(taskSegments.startPoints.begin() + std::get<1>(taskRange), std::get<2>(taskRange), segments.startPoints.begin() + segmentCount);
+        std::copy_n(taskSegments.endPoints.begin() + std::get<1>(taskRange), std::get<2>(taskRange), segments.endPoints.begin() + segmentCount);
+
+        segmentCount += std::get<2>(taskRange);
+    }
+
+    return segments;
+}
+
+inline SegmentStream& TessellateSplineBatch(SegmentStream& segments, const SplineBatch& batch, double tolerance = BEZIER_FLATNESS, int threadCount = 1)
+{
+    std::vector<SplineScratch> scratches;
+
+    return TessellateSplineBatch(segments, batch, tolerance, threadCount, scratches);
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawSegmentStream(Framebuffer<FORMAT>& framebuffer, const SegmentStream& segments, typename FORMAT::ColorType color, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    for (size_t index = 0; index < segments.GetCount(); ++index)
+        DrawLine(framebuffer, segments.startPoints[index], segments.endPoints[index], color, lineMode);
+
+    return framebuffer;
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawSplineSamples(Framebuffer<FORMAT>& framebuffer, const std::vector<Point<double>>& samples, typename FORMAT::ColorType color, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    PixelPoint startPoint;
+    PixelPoint endPoint;
+
+    for (size_t index = 1; index < samples.size(); ++index)
+    {
+        startPoint = { (coord_t)(samples[index - 1].x + 0.5), (coord_t)(samples[index - 1].y + 0.5) };
+        endPoint   = { (coord_t)(samples[index].x + 0.5), (coord_t)(samples[index].y + 0.5) };
+
+        DrawLine(framebuffer, startPoint, endPoint, color, lineMode);
+    }
+
+    return framebuffer;
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawBezierSpline(Framebuffer<FORMAT>& framebuffer, const std::vector<PixelPoint>& points, int steps, typename FORMAT::ColorType color, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    std::vector<Point<double>> samples;
+
+    return DrawSplineSamples(framebuffer, TessellateBezier(samples, points, steps), color, lineMode);
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawSpline(Framebuffer<FORMAT>& framebuffer, const std::vector<PixelPoint>& points, SPLINE spline, double tolerance, typename FORMAT::ColorType color, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    std::vector<Point<double>> samples;
+
+    return DrawSplineSamples(framebuffer, TessellateSpline(samples, points, spline, tolerance), color, lineMode);
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawSplineBatch(Framebuffer<FORMAT>& framebuffer, const SplineBatch& batch, double tolerance, typename FORMAT::ColorType color, int threadCount = 1, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    SegmentStream segments;
+
+    return DrawSegmentStream(framebuffer, TessellateSplineBatch(segments, batch, tolerance, threadCount), color, lineMode);
+}
\ No newline at end of file
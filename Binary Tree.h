@@ -0,0 +1,253 @@
+#pragma once
+
+#include "Wu Line.h"
+
+// Segments in heap order: the branches of segment n are 2n + 1 and 2n + 2, so a tree of depth steps has 2^steps - 1.
+struct TreeSegments
+{
+    std::vector<PixelPoint> startPoints;
+    std::vector<PixelPoint> endPoints;
+
+    size_t GetCount() const
+    {
+        return startPoints.size();
+    }
+
+    // Keeps the capacity, so regenerating a tree of the same depth never allocates.
+    void Resize(int steps)
+    {
+        size_t count = (steps > 0) ? (((size_t)1 << steps) - 1) : (0);
+
+        startPoints.resize(count);
+        endPoints.resize(count);
+    }
+};
+
+struct TreeRotation
+{
+    double cosine;
+    double sine;
+};
+
+static const int RANDOM_TREE_MIN_ANGLE = -10;
+static const int RANDOM_TREE_MAX_ANGLE = 60;
+
+// Matches the recursive trees bit for bit: the angle goes to radians in float, then through the double cos and sin.
+inline TreeRotation CreateTreeRotation(int degree)
+{
+    float radian = degree * 3.141592F / 180.0F;
+
+    return { cos(radian), sin(radian) };
+}
+
+// Every angle the random tree can turn by, the right branch's before the left's, indexed from the smallest.
+inline const TreeRotation* GetRandomTreeRotations()
+{
+    static const std::vector<TreeRotation> rotations = []()
+    {
+        std::vector<TreeRotation> rotations;
+
+        for (int degree = 180 - RANDOM_TREE_MAX_ANGLE; degree <= 180 + RANDOM_TREE_MAX_ANGLE; ++degree)
+            rotations.push_back(CreateTreeRotation(degree));
+
+        return rotations;
+    }();
+
+    return rotations.data();
+}
+
+// Rotates the point a branch starts shrinking from around the end of its parent.
+inline PixelPoint RotateBranch(PixelPoint decreasePoint, PixelPoint endPoint, TreeRotation rotation)
+{
+    return
+    {
+        (coord_t)(decreasePoint.x * rotation.cosine - decreasePoint.y * rotation.sine - endPoint.x * rotation.cosine + endPoint.y * rotation.sine + endPoint.x + 0.5),
+        (coord_t)(decreasePoint.x * rotation.sine + decreasePoint.y * rotation.cosine - endPoint.x * rotation.sine - endPoint.y * rotation.cosine + endPoint.y + 0.5)
+    };
+}
+
+// Builds levelCount levels of branches below segments firstIndex to lastIndex - 1, or until the list is full.
+template <typename BRANCHFUNCTION>
+inline void GenerateTreeLevels(TreeSegments& segments, size_t firstIndex, size_t lastIndex, int levelCount, BRANCHFUNCTION branchFunction)
+{
+    for (int level = 0; level < levelCount && 2 * lastIndex < segments.GetCount(); ++level)
+    {
+        for (size_t index = firstIndex; index < lastIndex; ++index)
+            branchFunction(index);
+
+        firstIndex = 2 * firstIndex + 1;
+        lastIndex  = 2 * lastIndex + 1;
+    }
+}
+
+// Every segment on TREE_TASK_LEVEL roots a subtree, task n being the one at index 2^TREE_TASK_LEVEL - 1 + n.
+static const int TREE_TASK_LEVEL = 6;
+static const int TREE_TASK_COUNT = 1 << TREE_TASK_LEVEL;
+
+inline TreeSegments& GenerateNormalTree(TreeSegments& segments, PixelPoint startPoint, PixelPoint endPoint, float decreaseRate, int theta, int steps, int threadCount = 1)
+{
+    TreeRotation leftRotation  = CreateTreeRotation(180 + theta);
+    TreeRotation rightRotation = CreateTreeRotation(180 - theta);
+
+    auto branchFunction = [&](size_t index)
+    {
+        PixelPoint parentStart = segments.startPoints[index];
+        PixelPoint parentEnd   = segments.endPoints[index];
+        PixelPoint decreasePoint;
+
+        decreasePoint.x = (coord_t)(parentStart.x + (parentEnd.x - parentStart.x) * (1.0 - decreaseRate));
+        decreasePoint.y = (coord_t)(parentStart.y + (parentEnd.y - parentStart.y) * (1.0 - decreaseRate));
+
+        segments.startPoints[2 * index + 1] = parentEnd;
+        segments.endPoints[2 * index + 1]   = RotateBranch(decreasePoint, parentEnd, leftRotation);
+        segments.startPoints[2 * index + 2] = parentEnd;
+        segments.endPoints[2 * index + 2]   = RotateBranch(decreasePoint, parentEnd, rightRotation);
+    };
+
+    segments.Resize(steps);
+    EXECUTION_CONDITION(steps > 0, segments);
+
+    segments.startPoints[0] = startPoint;
+    segments.endPoints[0]   = endPoint;
+
+    GenerateTreeLevels(segments, 0, 1, TREE_TASK_LEVEL, branchFunction);
+
+    if (steps > TREE_TASK_LEVEL + 1)
+        RunParallelTasks(TREE_TASK_COUNT, std::max(1, std::min(threadCount, TREE_TASK_COUNT)), [&](int, int task)
+        {
+            GenerateTreeLevels(segments, TREE_TASK_COUNT - 1 + task, TREE_TASK_COUNT + task, steps, branchFunction);
+        });
+
+    return segments;
+}
+
+// Subtree n draws from randomEngine jumped n + 1 times, and the engine is left one jump past the last subtree.
+inline TreeSegments& GenerateRandomTree(TreeSegments& segments, PixelPoint startPoint, PixelPoint endPoint, int steps, RandomEngine& randomEngine, int threadCount = 1)
+{
+    const TreeRotation*       rotations = GetRandomTreeRotations();
+    std::vector<RandomEngine> randomEngines;
+    RandomEngine              subtreeEngine = randomEngine;
+
+    auto branchFunction = [&](size_t index, RandomEngine& taskEngine)
+    {
+        PixelPoint parentStart = segments.startPoints[index];
+        PixelPoint parentEnd   = segments.endPoints[index];
+        PixelPoint decreasePoint;
+
+        decreasePoint.x = (coord_t)(parentStart.x + (parentEnd.x - parentStart.x) * (1.0 - taskEngine.CreateReal(0.45, 0.85)));
+        decreasePoint.y = (coord_t)(parentStart.y + (parentEnd.y - parentStart.y) * (1.0 - taskEngine.CreateReal(0.45, 0.85)));
+
+        segments.startPoints[2 * index + 1] = parentEnd;
+        segments.endPoints[2 * index + 1]   = RotateBranch(decreasePoint, parentEnd, rotations[RANDOM_TREE_MAX_ANGLE + taskEngine.CreateInteger(RANDOM_TREE_MIN_ANGLE, RANDOM_TREE_MAX_ANGLE)]);
+        segments.startPoints[2 * index + 2] = parentEnd;
+        segments.endPoints[2 * index + 2]   = RotateBranch(decreasePoint, parentEnd, rotations[RANDOM_TREE_MAX_ANGLE - taskEngine.CreateInteger(RANDOM_TREE_MIN_ANGLE, RANDOM_TREE_MAX_ANGLE)]);
+    };
+
+    segments.Resize(steps);
+    EXECUTION_CONDITION(steps > 0, segments);
+
+    segments.startPoints[0] = startPoint;
+    segments.endPoints[0]   = endPoint;
+
+    GenerateTreeLevels(segments, 0, 1, TREE_TASK_LEVEL, [&](size_t index) { branchFunction(index, randomEngine); });
+
+    if (steps > TREE_TASK_LEVEL + 1)
+    {
+        for (int task = 0; task < TREE_TASK_COUNT; ++task)
+        {
+            subtreeEngine.Jump();
+            randomEngines.push_back(subtreeEngine);
+        }
+
+        randomEngine = subtreeEngine;
+        randomEngine.Jump();
+
+        RunParallelTasks(TREE_TASK_COUNT, std::max(1, std::min(threadCount, TREE_TASK_COUNT)), [&](int, int task)
+        {
+            GenerateTreeLevels(segments, TREE_TASK_COUNT - 1 + task, TREE_TASK_COUNT + task, steps, [&](size_t index) { branchFunction(index, randomEngines[task]); });
+        });
+    }
+
+    return segments;
+}
+
+// Draws segments firstSegment to lastSegment - 1.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& RasterizeTreeSegments(Framebuffer<FORMAT>& framebuffer, const TreeSegments& segments, size_t firstSegment, size_t lastSegment, typename FORMAT::ColorType color, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    for (size_t index = firstSegment; index < lastSegment; ++index)
+        DrawLine(framebuffer, segments.startPoints[index], segments.endPoints[index], color, lineMode);
+
+    return framebuffer;
+}
+
+// Only worker 0 draws; the others mark coverage masks that are folded in band by band at the end.
+// Blends depend on their order, so an anti-aliased tree is drawn by one worker in segment order.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& RasterizeTree(Framebuffer<FORMAT>& framebuffer, const TreeSegments& segments, typename FORMAT::ColorType color, int threadCount = 1, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    int                             workerCount = std::max(1, std::min(threadCount, TREE_TASK_COUNT));
+    std::vector<Framebuffer<Gray8>> coverageMasks;
+
+    if (workerCount == 1 || segments.GetCount() < 2 * TREE_TASK_COUNT - 1 || lineMode == LINEMODE::ANTIALIASED)
+        return RasterizeTreeSegments(framebuffer, segments, 0, segments.GetCount(), color, lineMode);
+
+    RasterizeTreeSegments(framebuffer, segments, 0, TREE_TASK_COUNT - 1, color);
+
+    for (int worker = 1; worker < workerCount; ++worker)
+    {
+        coverageMasks.emplace_back(framebuffer.GetWidth(), framebuffer.GetHeight());
+        coverageMasks.back().Clear(0);
+    }
+
+    RunParallelTasks(TREE_TASK_COUNT, workerCount, [&](int worker, int task)
+    {
+        size_t firstIndex = TREE_TASK_COUNT - 1 + task;
+        size_t lastIndex  = TREE_TASK_COUNT + task;
+
+        for (; firstIndex < segments.GetCount(); firstIndex = 2 * firstIndex + 1, lastIndex = 2 * lastIndex + 1)
+        {
+            if (worker == 0)
+                RasterizeTreeSegments(framebuffer, segments, firstIndex, lastIndex, color);
+            else
+                RasterizeTreeSegments(coverageMasks[worker - 1], segments, firstIndex, lastIndex, (byte_t)255);
+        }
+    });
+
+    RunParallelTasks(framebuffer.GetHeight(), workerCount, [&](int, int row)
+    {
+        byte_t*       pixel = framebuffer.GetPixel(0, row);
+        const byte_t* coverage;
+
+        for (const Framebuffer<Gray8>& coverageMask : coverageMasks)
+        {
+            coverage = coverageMask.GetData() + row * coverageMask.GetStride();
+
+            for (coord_t x = 0; x < framebuffer.GetWidth(); ++x)
+                if (coverage[x] != 0)
+                    FORMAT::Store(pixel + (size_t)x * FORMAT::CHANNEL_COUNT, color);
+        }
+    });
+
+    return framebuffer;
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawNormalTree(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, float decreaseRate, int theta, int steps, typename FORMAT::ColorType color, int threadCount = 1, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    TreeSegments segments;
+
+    GenerateNormalTree(segments, startPoint, endPoint, decreaseRate, theta, steps, threadCount);
+
+    return RasterizeTree(framebuffer, segments, color, threadCount, lineMode);
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawRandomTree(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, int steps, typename FORMAT::ColorType color, RandomEngine& randomEngine, int threadCount = 1, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    TreeSegments segments;
+
+    GenerateRandomTree(segments, startPoint, endPoint, steps, randomEngine, threadCount);
+
+    return RasterizeTree(framebuffer, segments, color, threadCount, lineMode);
+}
\ No newline at end of file
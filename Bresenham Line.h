@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Raster.h"
+
+// Pixel k sits floor((2 * minorLength * k + majorLength) / (2 * majorLength)) along the minor axis, so runs clip exactly.
+inline bool ClipBresenhamRun(coord_t majorStart, coord_t minorStart, coord_t majorLength, coord_t minorLength, int direction, coord_t majorLimit, coord_t minorLimit, long long& firstIndex, long long& lastIndex)
+{
+    long long lowerOffset = (direction > 0) ? (-(long long)minorStart) : ((long long)minorStart - minorLimit + 1);
+    long long upperOffset = (direction > 0) ? ((long long)minorLimit - 1 - minorStart) : ((long long)minorStart);
+
+    firstIndex = std::max(0LL, -(long long)majorStart);
+    lastIndex  = std::min((long long)majorLength, (long long)majorLimit - 1 - majorStart);
+
+    EXECUTION_CONDITION(upperOffset >= 0 && lowerOffset <= upperOffset, false);
+
+    if (minorLength == 0)
+        return lowerOffset <= 0 && firstIndex <= lastIndex;
+
+    if (lowerOffset > 0)
+        firstIndex = std::max(firstIndex, (2LL * majorLength * lowerOffset - majorLength + 2LL * minorLength - 1) / (2LL * minorLength));
+
+    lastIndex = std::min(lastIndex, (2LL * majorLength * (upperOffset + 1) - majorLength - 1) / (2LL * minorLength));
+
+    return firstIndex <= lastIndex;
+}
+
+// Slices at least this long along x are written by FORMAT::Fill, whose block copies only pay off past a few pixels.
+static const long long BRESENHAM_SPAN_LENGTH = 16;
+
+// Runs whose slices are shorter than this keep to the pixel-by-pixel walk, which costs less per slice of one or two.
+static const coord_t   BRESENHAM_SLICE_LENGTH = 4;
+
+// Writes one slice where the dash mask allows and returns the pixel one step past it.
+template <typename FORMAT>
+inline byte_t* DrawBresenhamSlice(byte_t* pixel, long long firstIndex, long long lastIndex, ptrdiff_t step, typename FORMAT::ColorType color, byte_t mask)
+{
+    if (mask == 0xFF)
+    {
+        if (step == FORMAT::CHANNEL_COUNT && lastIndex - firstIndex + 1 >= BRESENHAM_SPAN_LENGTH)
+        {
+            FORMAT::Fill(pixel, (size_t)(lastIndex - firstIndex + 1), color);
+            return pixel + (lastIndex - firstIndex + 1) * step;
+        }
+
+        for (long long index = firstIndex; index <= lastIndex; ++index, pixel += step)
+            FORMAT::Store(pixel, color);
+
+        return pixel;
+    }
+
+    for (long long index = firstIndex; index <= lastIndex; ++index, pixel += step)
+        if (((mask >> (index & 7)) & 1) != 0)
+            FORMAT::Store(pixel, color);
+
+    return pixel;
+}
+
+// Walks the clipped run a slice of one minor offset at a time, or pixel by pixel when it is close to diagonal.
+template <typename FORMAT>
+inline void DrawBresenhamRun(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, coord_t majorLength, coord_t minorLength, int direction, bool isMajorX, typename FORMAT::ColorType color, byte_t mask)
+{
+    long long firstIndex;
+    long long lastIndex;
+    long long minorOffset;
+    long long discriminant;
+    long long nextStart;
+    long long remainder;
+    long long wholeStep;
+    long long partStep;
+    ptrdiff_t majorStep;
+    ptrdiff_t minorStep;
+    byte_t*   pixel;
+    bool      isVisible;
+
+    if (isMajorX == true)
+        isVisible = ClipBresenhamRun(startPoint.x, startPoint.y, majorLength, minorLength, direction, framebuffer.GetWidth(),  framebuffer.GetHeight(), firstIndex, lastIndex);
+    else
+        isVisible = ClipBresenhamRun(startPoint.y, startPoint.x, majorLength, minorLength, direction, framebuffer.GetHeight(), framebuffer.GetWidth(),  firstIndex, lastIndex);
+
+    if (isVisible == false)
+        return;
+
+    minorOffset = (2LL * minorLength * firstIndex + majorLength) / (2LL * majorLength);
+    majorStep   = (isMajorX == true) ? (framebuffer.GetOffset(1, 0))         : (framebuffer.GetOffset(0, 1));
+    minorStep   = (isMajorX == true) ? (framebuffer.GetOffset(0, direction)) : (framebuffer.GetOffset(direction, 0));
+
+    if (isMajorX == true)
+        pixel = framebuffer.GetPixel(startPoint.x + (coord_t)firstIndex, startPoint.y + direction * (coord_t)minorOffset);
+    else
+        pixel = framebuffer.GetPixel(startPoint.x + direction * (coord_t)minorOffset, startPoint.y + (coord_t)firstIndex);
+
+    if (minorLength == 0)
+    {
+        DrawBresenhamSlice<FORMAT>(pixel, firstIndex, lastIndex, majorStep, color, mask);
+        return;
+    }
+
+    if (majorLength < BRESENHAM_SLICE_LENGTH * minorLength)
+    {
+        discriminant = 2LL * minorLength * (firstIndex + 1) - majorLength - 2LL * majorLength * minorOffset;
+
+        for (long long index = firstIndex; index <= lastIndex; ++index)
+        {
+            if (((mask >> (index & 7)) & 1) != 0)
+                FORMAT::Store(pixel, color);
+
+            if (index == lastIndex)
+                break;
+
+            pixel        += (discriminant < 0) ? (majorStep) : (majorStep + minorStep);
+            discriminant += (discriminant < 0) ? (2 * minorLength) : (2 * (minorLength - majorLength));
+        }
+
+        return;
+    }
+
+    nextStart = ((2 * minorOffset + 1) * majorLength + 2LL * minorLength - 1) / (2LL * minorLength);
+    remainder = ((2 * minorOffset + 1) * majorLength + 2LL * minorLength - 1) % (2LL * minorLength);
+    wholeStep = majorLength / minorLength;
+    partStep  = 2LL * (majorLength % minorLength);
+
+    while (nextStart <= lastIndex)
+    {
+        pixel      = DrawBresenhamSlice<FORMAT>(pixel, firstIndex, nextStart - 1, majorStep, color, mask) + minorStep;
+        firstIndex = nextStart;
+        nextStart += wholeStep;
+        remainder += partStep;
+
+        if (remainder >= 2LL * minorLength)
+        {
+            remainder -= 2LL * minorLength;
+            ++nextStart;
+        }
+    }
+
+    DrawBresenhamSlice<FORMAT>(pixel, firstIndex, lastIndex, majorStep, color, mask);
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawBresenhamLine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    PixelSize  variation = { abs(endPoint.x - startPoint.x), abs(endPoint.y - startPoint.y) };
+    PixelPoint tempPoint;
+    int        direction;
+
+    if (variation.cx > variation.cy)
+    {
+        if (startPoint.x > endPoint.x)
+        {
+            direction = (startPoint.y > endPoint.y) ? (1) : (-1);
+            SWAP(startPoint, endPoint, tempPoint);
+        }
+        else
+            direction = (startPoint.y < endPoint.y) ? (1) : (-1);
+
+        DrawBresenhamRun(framebuffer, startPoint, variation.cx, variation.cy, direction, true, color, LINE_MASKS[(int)lineType]);
+    }
+    else if (variation.cy > 0)
+    {
+        if (startPoint.y > endPoint.y)
+        {
+            direction = (startPoint.x > endPoint.x) ? (1) : (-1);
+            SWAP(startPoint, endPoint, tempPoint);
+        }
+        else
+            direction = (startPoint.x < endPoint.x) ? (1) : (-1);
+
+        DrawBresenhamRun(framebuffer, startPoint, variation.cy, variation.cx, direction, false, color, LINE_MASKS[(int)lineType]);
+    }
+    else if ((LINE_MASKS[(int)lineType] & 1) != 0)
+        SetPixel(framebuffer, startPoint, color);
+
+    return framebuffer;
+}
+
+// Batches draw their lines ordered by the tile holding their midpoint, so consecutive lines share rows in cache.
+static const coord_t BRESENHAM_TILE_SIZE = 256;
+
+// Lines of one colour and style leave the same pixels in any order, so a batch may be sorted by tile.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawBresenhamLines(Framebuffer<FORMAT>& framebuffer, const PixelPoint* startPoints, const PixelPoint* endPoints, size_t lineCount, typename FORMAT::ColorType color, LINETYPE lineType)
+{
+    coord_t             columnCount = framebuffer.GetWidth()  / BRESENHAM_TILE_SIZE + 1;
+    coord_t             rowCount    = framebuffer.GetHeight() / BRESENHAM_TILE_SIZE + 1;
+    std::vector<size_t> tileStarts((size_t)columnCount * rowCount + 1, 0);
+    std::vector<size_t> lineOrder(lineCount);
+
+    EXECUTION_CONDITION(lineCount > 0 && framebuffer.GetWidth() > 0 && framebuffer.GetHeight() > 0, framebuffer);
+
+    // Midpoints off the framebuffer are clamped to its border tiles.
+    auto findTile = [&](size_t index)
+    {
+        long long x = std::min(std::max(((long long)startPoints[index].x + endPoints[index].x) / 2, 0LL), (long long)framebuffer.GetWidth()  - 1);
+        long long y = std::min(std::max(((long long)startPoints[index].y + endPoints[index].y) / 2, 0LL), (long long)framebuffer.GetHeight() - 1);
+
+        return (size_t)(y / BRESENHAM_TILE_SIZE * columnCount + x / BRESENHAM_TILE_SIZE);
+    };
+
+    for (size_t index = 0; index < lineCount; ++index)
+        ++tileStarts[findTile(index) + 1];
+
+    for (size_t tile = 1; tile < tileStarts.size(); ++tile)
+        tileStarts[tile] += tileStarts[tile - 1];
+
+    for (size_t index = 0; index < lineCount; ++index)
+        lineOrder[tileStarts[findTile(index)]++] = index;
+
+    for (size_t index : lineOrder)
+        DrawBresenhamLine(framebuffer, startPoints[index], endPoints[index], color, lineType);
+
+    return framebuffer;
+}
\ No newline at end of file
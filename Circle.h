@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Raster.h"
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawCircle(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, coord_t radius, typename FORMAT::ColorType color)
+{
+    PixelPoint symmetryPoint = { 0, radius };
+    int        discriminant  = 1 - radius;
+    CLIPPING   clipping      = ClipBoundingBox(framebuffer, { centerPoint.x - radius, centerPoint.y - radius, centerPoint.x + radius, centerPoint.y + radius });
+    byte_t*    centerPixel;
+
+    EXECUTION_CONDITION(radius >= 0 && clipping != CLIPPING::OUTSIDE, framebuffer);
+
+    // A circle wholly inside the framebuffer writes its eight octants as offsets from the centre pixel, without bounds checks.
+    centerPixel = (clipping == CLIPPING::INSIDE) ? (framebuffer.GetPixel(centerPoint.x, centerPoint.y)) : (nullptr);
+
+    while (symmetryPoint.x <= symmetryPoint.y)
+    {
+        if (clipping == CLIPPING::INSIDE)
+        {
+            FORMAT::Store(centerPixel + framebuffer.GetOffset( symmetryPoint.x,  symmetryPoint.y), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset( symmetryPoint.x, -symmetryPoint.y), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset(-symmetryPoint.x,  symmetryPoint.y), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset(-symmetryPoint.x, -symmetryPoint.y), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset( symmetryPoint.y,  symmetryPoint.x), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset( symmetryPoint.y, -symmetryPoint.x), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset(-symmetryPoint.y,  symmetryPoint.x), color);
+            FORMAT::Store(centerPixel + framebuffer.GetOffset(-symmetryPoint.y, -symmetryPoint.x), color);
+        }
+        else
+        {
+            SetPixel(framebuffer, { centerPoint.x + symmetryPoint.x, centerPoint.y + symmetryPoint.y }, color);
+            SetPixel(framebuffer, { centerPoint.x + symmetryPoint.x, centerPoint.y - symmetryPoint.y }, color);
+            SetPixel(framebuffer, { centerPoint.x - symmetryPoint.x, centerPoint.y + symmetryPoint.y }, color);
+            SetPixel(framebuffer, { centerPoint.x - symmetryPoint.x, centerPoint.y - symmetryPoint.y }, color);
+            SetPixel(framebuffer, { centerPoint.x + symmetryPoint.y, centerPoint.y + symmetryPoint.x }, color);
+            SetPixel(framebuffer, { centerPoint.x + symmetryPoint.y, centerPoint.y - symmetryPoint.x }, color);
+            SetPixel(framebuffer, { centerPoint.x - symmetryPoint.y, centerPoint.y + symmetryPoint.x }, color);
+            SetPixel(framebuffer, { centerPoint.x - symmetryPoint.y, centerPoint.y - symmetryPoint.x }, color);
+        }
+
+        symmetryPoint.x += 1;
+
+        if (discriminant < 0)
+            discriminant += 2 * symmetryPoint.x + 1;
+        else
+        {
+            symmetryPoint.y -= 1;
+            discriminant    += 2 * (symmetryPoint.x - symmetryPoint.y) + 1;
+        }
+    }
+
+    return framebuffer;
+}
+
+// Fills each row of the disc DrawCircle outlines once, as one span, when the midpoint walk leaves it.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& FillCircle(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, coord_t radius, typename FORMAT::ColorType color)
+{
+    PixelPoint symmetryPoint = { 0, radius };
+    int        discriminant  = 1 - radius;
+
+    EXECUTION_CONDITION(radius >= 0 && ClipBoundingBox(framebuffer, { centerPoint.x - radius, centerPoint.y - radius, centerPoint.x + radius, centerPoint.y + radius }) != CLIPPING::OUTSIDE, framebuffer);
+
+    while (symmetryPoint.x <= symmetryPoint.y)
+    {
+        FillSpan(framebuffer, centerPoint.y + symmetryPoint.x, centerPoint.x - symmetryPoint.y, centerPoint.x + symmetryPoint.y, color);
+
+        if (symmetryPoint.x != 0)
+            FillSpan(framebuffer, centerPoint.y - symmetryPoint.x, centerPoint.x - symmetryPoint.y, centerPoint.x + symmetryPoint.y, color);
+
+        if (discriminant >= 0 && symmetryPoint.y > symmetryPoint.x)
+        {
+            FillSpan(framebuffer, centerPoint.y + symmetryPoint.y, centerPoint.x - symmetryPoint.x, centerPoint.x + symmetryPoint.x, color);
+            FillSpan(framebuffer, centerPoint.y - symmetryPoint.y, centerPoint.x - symmetryPoint.x, centerPoint.x + symmetryPoint.x, color);
+        }
+
+        symmetryPoint.x += 1;
+
+        if (discriminant < 0)
+            discriminant += 2 * symmetryPoint.x + 1;
+        else
+        {
+            symmetryPoint.y -= 1;
+            discriminant    += 2 * (symmetryPoint.x - symmetryPoint.y) + 1;
+        }
+    }
+
+    return framebuffer;
+}
\ No newline at end of file
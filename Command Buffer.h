@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Bresenham Line.h"
+#include "Circle.h"
+#include "DDA Line.h"
+#include "Ellipse.h"
+
+enum class COMMAND
+{
+    DDA_LINE       = 0,
+    BRESENHAM_LINE = 1,
+    CIRCLE         = 2,
+    ELLIPSE        = 3
+};
+
+// Primitives in structure-of-arrays form, each with an inclusive box of the pixels it can write for binning.
+template <typename FORMAT>
+struct CommandBuffer
+{
+    typedef typename FORMAT::ColorType ColorType;
+
+    std::vector<COMMAND>        commands;
+    std::vector<PixelPoint>     startPoints;
+    std::vector<PixelPoint>     endPoints;
+    std::vector<PixelSize>      radii;
+    std::vector<int>            thetas;
+    std::vector<LINETYPE>       lineTypes;
+    std::vector<ColorType>      colors;
+    std::vector<PixelRectangle> boxes;
+
+    size_t GetCount() const
+    {
+        return commands.size();
+    }
+
+    void AddDDALine(PixelPoint startPoint, PixelPoint endPoint, ColorType color, LINETYPE lineType = LINETYPE::SOLID)
+    {
+        AddLine(COMMAND::DDA_LINE, startPoint, endPoint, color, lineType);
+    }
+
+    void AddBresenhamLine(PixelPoint startPoint, PixelPoint endPoint, ColorType color, LINETYPE lineType = LINETYPE::SOLID)
+    {
+        AddLine(COMMAND::BRESENHAM_LINE, startPoint, endPoint, color, lineType);
+    }
+
+    void AddCircle(PixelPoint centerPoint, coord_t radius, ColorType color)
+    {
+        Add(COMMAND::CIRCLE, centerPoint, centerPoint, { radius, radius }, 0, LINETYPE::SOLID, color, { centerPoint.x - radius, centerPoint.y - radius, centerPoint.x + radius, centerPoint.y + radius });
+    }
+
+    // The box DrawEllipse clips against: the rotated extent plus two pixels, which also covers the aligned outlines.
+    void AddEllipse(PixelPoint centerPoint, PixelSize radius, int theta, ColorType color)
+    {
+        float     radian = theta * 3.141592F / 180.0F;
+        PixelSize extent = { (coord_t)hypot(radius.cx * cos(radian), radius.cy * sin(radian)) + 2, (coord_t)hypot(radius.cx * sin(radian), radius.cy * cos(radian)) + 2 };
+
+        Add(COMMAND::ELLIPSE, centerPoint, centerPoint, radius, theta, LINETYPE::SOLID, color, { centerPoint.x - extent.cx, centerPoint.y - extent.cy, centerPoint.x + extent.cx, centerPoint.y + extent.cy });
+    }
+
+    void Clear()
+    {
+        commands.clear();
+        startPoints.clear();
+        endPoints.clear();
+        radii.clear();
+        thetas.clear();
+        lineTypes.clear();
+        colors.clear();
+        boxes.clear();
+    }
+
+private:
+    // Both line rasterisers keep to the box of the end points.
+    void AddLine(COMMAND command, PixelPoint startPoint, PixelPoint endPoint, ColorType color, LINETYPE lineType)
+    {
+        Add(command, startPoint, endPoint, { 0, 0 }, 0, lineType, color, { std::min(startPoint.x, endPoint.x), std::min(startPoint.y, endPoint.y), std::max(startPoint.x, endPoint.x), std::max(startPoint.y, endPoint.y) });
+    }
+
+    void Add(COMMAND command, PixelPoint startPoint, PixelPoint endPoint, PixelSize radius, int theta, LINETYPE lineType, ColorType color, PixelRectangle box)
+    {
+        commands.push_back(command);
+        startPoints.push_back(startPoint);
+        endPoints.push_back(endPoint);
+        radii.push_back(radius);
+        thetas.push_back(theta);
+        lineTypes.push_back(lineType);
+        colors.push_back(color);
+        boxes.push_back(box);
+    }
+};
+
+// A tile stays in L2; smaller tiles make circles and rotated ellipses re-walk more than the cache saves.
+static const coord_t COMMAND_TILE_SIZE = 256;
+
+// Draws one command into a framebuffer whose pixel (0, 0) is the image's pixel at origin.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& ExecuteCommand(Framebuffer<FORMAT>& framebuffer, const CommandBuffer<FORMAT>& buffer, size_t index, PixelPoint origin)
+{
+    PixelPoint startPoint = { buffer.startPoints[index].x - origin.x, buffer.startPoints[index].y - origin.y };
+    PixelPoint endPoint   = { buffer.endPoints[index].x - origin.x, buffer.endPoints[index].y - origin.y };
+
+    switch (buffer.commands[index])
+    {
+    case COMMAND::DDA_LINE:
+        return DrawDDALine(framebuffer, startPoint, endPoint, buffer.colors[index], buffer.lineTypes[index]);
+
+    case COMMAND::BRESENHAM_LINE:
+        return DrawBresenhamLine(framebuffer, startPoint, endPoint, buffer.colors[index], buffer.lineTypes[index]);
+
+    case COMMAND::CIRCLE:
+        return DrawCircle(framebuffer, startPoint, buffer.radii[index].cx, buffer.colors[index]);
+
+    case COMMAND::ELLIPSE:
+        return DrawEllipse(framebuffer, startPoint, buffer.radii[index], buffer.thetas[index], buffer.colors[index]);
+    }
+
+    return framebuffer;
+}
+
+// A counting sort bins the commands by tile in record order, and each tile draws its list through a framebuffer attached to it.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& ExecuteCommandBuffer(Framebuffer<FORMAT>& framebuffer, const CommandBuffer<FORMAT>& buffer, int threadCount = 1)
+{
+    coord_t             columnCount = (framebuffer.GetWidth()  + COMMAND_TILE_SIZE - 1) / COMMAND_TILE_SIZE;
+    coord_t             rowCount    = (framebuffer.GetHeight() + COMMAND_TILE_SIZE - 1) / COMMAND_TILE_SIZE;
+    int                 tileCount   = (int)(columnCount * rowCount);
+    int                 workerCount = std::max(1, std::min(threadCount, tileCount));
+    std::vector<size_t> tileStarts(tileCount + 1, 0);
+    std::vector<size_t> tileCommands;
+    std::vector<size_t> tileEnds;
+    PixelRectangle      tiles;
+
+    EXECUTION_CONDITION(tileCount > 0 && buffer.GetCount() > 0, framebuffer);
+
+    // The range of tiles a box covers, or false for a box that misses the image.
+    auto findTiles = [&](size_t index, PixelRectangle& range)
+    {
+        const PixelRectangle& box = buffer.boxes[index];
+
+        if (ClipBoundingBox(framebuffer, box) == CLIPPING::OUTSIDE)
+            return false;
+
+        range = { std::max(box.left, 0) / COMMAND_TILE_SIZE, std::max(box.top, 0) / COMMAND_TILE_SIZE, std::min(box.right, framebuffer.GetWidth() - 1) / COMMAND_TILE_SIZE, std::min(box.bottom, framebuffer.GetHeight() - 1) / COMMAND_TILE_SIZE };
+
+        return true;
+    };
+
+    for (size_t index = 0; index < buffer.GetCount(); ++index)
+        if (findTiles(index, tiles) == true)
+            for (coord_t row = tiles.top; row <= tiles.bottom; ++row)
+                for (coord_t column = tiles.left; column <= tiles.right; ++column)
+                    ++tileStarts[row * columnCount + column + 1];
+
+    for (int tile = 0; tile < tileCount; ++tile)
+        tileStarts[tile + 1] += tileStarts[tile];
+
+    tileCommands.resize(tileStarts[tileCount]);
+    tileEnds.assign(tileStarts.begin(), tileStarts.end() - 1);
+
+    for (size_t index = 0; index < buffer.GetCount(); ++index)
+        if (findTiles(index, tiles) == true)
+            for (coord_t row = tiles.top; row <= tiles.bottom; ++row)
+                for (coord_t column = tiles.left; column <= tiles.right; ++column)
+                    tileCommands[tileEnds[row * columnCount + column]++] = index;
+
+    RunParallelTasks(tileCount, workerCount, [&](int, int tile)
+    {
+        PixelPoint          origin = { (tile % columnCount) * COMMAND_TILE_SIZE, (tile / columnCount) * COMMAND_TILE_SIZE };
+        Framebuffer<FORMAT> tileFramebuffer;
+
+        if (tileStarts[tile] == tileStarts[tile + 1])
+            return;
+
+        tileFramebuffer.Attach(framebuffer.GetPixel(origin.x, origin.y), std::min(COMMAND_TILE_SIZE, framebuffer.GetWidth() - origin.x), std::min(COMMAND_TILE_SIZE, framebuffer.GetHeight() - origin.y), framebuffer.GetStride());
+
+        for (size_t position = tileStarts[tile]; position < tileStarts[tile + 1]; ++position)
+            ExecuteCommand(tileFramebuffer, buffer, tileCommands[position], origin);
+    });
+
+    return framebuffer;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Raster.h"
+
+// Division rounding towards minus infinity, for a positive denominator.
+inline long long FloorDivide(long long numerator, long long denominator)
+{
+    return (numerator >= 0) ? (numerator / denominator) : (-((-numerator + denominator - 1) / denominator));
+}
+
+// Pixel k lies floor((2 * k * variation + step) / (2 * step)) along each axis, monotonic in k, so clipping is exact.
+inline bool ClipDDAAxis(coord_t start, coord_t variation, long long step, coord_t limit, long long& firstIndex, long long& lastIndex)
+{
+    long long lowerOffset = -(long long)start;
+    long long upperOffset = (long long)limit - 1 - start;
+
+    if (variation == 0)
+        return lowerOffset <= 0 && upperOffset >= 0 && firstIndex <= lastIndex;
+
+    if (variation > 0)
+    {
+        firstIndex = std::max(firstIndex, -FloorDivide(step - 2 * step * lowerOffset, 2LL * variation));
+        lastIndex  = std::min(lastIndex, FloorDivide(2 * step * (upperOffset + 1) - step - 1, 2LL * variation));
+    }
+    else
+    {
+        firstIndex = std::max(firstIndex, FloorDivide(step - 2 * step * (upperOffset + 1), -2LL * variation) + 1);
+        lastIndex  = std::min(lastIndex, FloorDivide(step - 2 * step * lowerOffset, -2LL * variation));
+    }
+
+    return firstIndex <= lastIndex;
+}
+
+// The minor coordinate is a whole part and a remainder in 1 / (2 * step), so the line never drifts.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawDDALine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType = LINETYPE::SOLID)
+{
+    PixelSize variation      = { endPoint.x - startPoint.x, endPoint.y - startPoint.y };
+    long long step           = std::max(llabs(variation.cx), llabs(variation.cy));
+    long long denominator    = 2 * step;
+    bool      isMajorX       = llabs(variation.cx) == step;
+    long long minorVariation = (isMajorX == true) ? (variation.cy) : (variation.cx);
+    byte_t    mask           = LINE_MASKS[(int)lineType];
+    long long firstIndex     = 0;
+    long long lastIndex      = step;
+    long long offsetX;
+    long long offsetY;
+    long long remainder;
+    long long wholeMinor;
+    long long part;
+    long long carry;
+    ptrdiff_t wholeStep;
+    ptrdiff_t carryStep;
+    CLIPPING  clipping;
+    byte_t*   pixel;
+
+    if (step == 0)
+    {
+        if ((mask & 1) != 0)
+            SetPixel(framebuffer, startPoint, color);
+
+        return framebuffer;
+    }
+
+    // A line wholly inside starts at index 0 and needs no division at all; one wholly outside needs no clipping.
+    clipping = ClipBoundingBox(framebuffer, { std::min(startPoint.x, endPoint.x), std::min(startPoint.y, endPoint.y), std::max(startPoint.x, endPoint.x), std::max(startPoint.y, endPoint.y) });
+    EXECUTION_CONDITION(clipping != CLIPPING::OUTSIDE, framebuffer);
+
+    if (clipping == CLIPPING::PARTIAL)
+    {
+        EXECUTION_CONDITION(ClipDDAAxis(startPoint.x, variation.cx, step, framebuffer.GetWidth(),  firstIndex, lastIndex), framebuffer);
+        EXECUTION_CONDITION(ClipDDAAxis(startPoint.y, variation.cy, step, framebuffer.GetHeight(), firstIndex, lastIndex), framebuffer);
+    }
+
+    offsetX    = (firstIndex == 0) ? (0) : (FloorDivide(2 * firstIndex * variation.cx + step, denominator));
+    offsetY    = (firstIndex == 0) ? (0) : (FloorDivide(2 * firstIndex * variation.cy + step, denominator));
+    remainder  = 2 * firstIndex * minorVariation + step - ((isMajorX == true) ? (offsetY) : (offsetX)) * denominator;
+
+    // No variation exceeds step, so the whole part of the minor increase is -1, 0 or 1 and the rest is a carry.
+    wholeMinor = (minorVariation == step) ? (1) : ((minorVariation < 0) ? (-1) : (0));
+    part       = 2 * minorVariation - wholeMinor * denominator;
+    wholeStep  = (isMajorX == true) ? (framebuffer.GetOffset((variation.cx < 0) ? (-1) : (1), (coord_t)wholeMinor)) : (framebuffer.GetOffset((coord_t)wholeMinor, (variation.cy < 0) ? (-1) : (1)));
+    carryStep  = (isMajorX == true) ? (framebuffer.GetOffset(0, 1)) : (framebuffer.GetOffset(1, 0));
+    pixel      = framebuffer.GetPixel(startPoint.x + (coord_t)offsetX, startPoint.y + (coord_t)offsetY);
+
+    for (long long index = firstIndex; index <= lastIndex; ++index)
+    {
+        if (((mask >> (index & 7)) & 1) != 0)
+            FORMAT::Store(pixel, color);
+
+        if (index == lastIndex)
+            break;
+
+        remainder += part;
+        carry      = (remainder >= denominator) ? (1) : (0);
+        remainder -= carry * denominator;
+        pixel     += wholeStep + (ptrdiff_t)carry * carryStep;
+    }
+
+    return framebuffer;
+}
\ No newline at end of file
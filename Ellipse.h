@@ -0,0 +1,452 @@
+#pragma once
+
+#include "Raster.h"
+
+// Mirrors a first-quadrant point of the axis-aligned ellipse into all four quadrants around the centre.
+template <typename FORMAT>
+inline void DrawEllipsePoints(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelPoint symmetryPoint, CLIPPING clipping, typename FORMAT::ColorType color)
+{
+    PixelPoint points[4] =
+    {
+        { centerPoint.x + symmetryPoint.x, centerPoint.y + symmetryPoint.y },
+        { centerPoint.x + symmetryPoint.x, centerPoint.y - symmetryPoint.y },
+        { centerPoint.x - symmetryPoint.x, centerPoint.y + symmetryPoint.y },
+        { centerPoint.x - symmetryPoint.x, centerPoint.y - symmetryPoint.y }
+    };
+
+    for (const PixelPoint& point : points)
+    {
+        if (clipping == CLIPPING::INSIDE)
+            FORMAT::Store(framebuffer.GetPixel(point.x, point.y), color);
+        else
+            SetPixel(framebuffer, point, color);
+    }
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawAlignedEllipse(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelSize radius, typename FORMAT::ColorType color)
+{
+    Size<long long>  squaredRadius     = { (long long)radius.cx * radius.cx, (long long)radius.cy * radius.cy };
+    PixelPoint       symmetryPoint     = { 0, radius.cy };
+    Point<long long> discriminantPoint = { 0, 2 * squaredRadius.cx * radius.cy };
+    CLIPPING         clipping          = ClipBoundingBox(framebuffer, { centerPoint.x - radius.cx, centerPoint.y - radius.cy, centerPoint.x + radius.cx, centerPoint.y + radius.cy });
+    long long        discriminant;
+
+    EXECUTION_CONDITION(clipping != CLIPPING::OUTSIDE, framebuffer);
+
+    // A zero radius leaves a segment, which the midpoint steps would overshoot or, along x, never finish.
+    if (radius.cx == 0 || radius.cy == 0)
+    {
+        for (coord_t y = -radius.cy; y <= radius.cy; ++y)
+            FillSpan(framebuffer, centerPoint.y + y, centerPoint.x - radius.cx, centerPoint.x + radius.cx, color);
+
+        return framebuffer;
+    }
+
+    discriminant = (long long)(squaredRadius.cy - squaredRadius.cx * radius.cy + 0.25 * squaredRadius.cx + 0.5);
+
+    while (discriminantPoint.x <= discriminantPoint.y)
+    {
+        DrawEllipsePoints(framebuffer, centerPoint, symmetryPoint, clipping, color);
+
+        symmetryPoint.x     += 1;
+        discriminantPoint.x += 2 * squaredRadius.cy;
+
+        if (discriminant < 0)
+            discriminant += squaredRadius.cy + discriminantPoint.x;
+        else
+        {
+            symmetryPoint.y     -= 1;
+            discriminantPoint.y -= 2 * squaredRadius.cx;
+            discriminant        += squaredRadius.cy + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+
+    discriminant = (long long)(squaredRadius.cy * (symmetryPoint.x + 0.5) * (symmetryPoint.x + 0.5) + squaredRadius.cx * (symmetryPoint.y - 1) * (symmetryPoint.y - 1) - squaredRadius.cx * squaredRadius.cy);
+
+    while (symmetryPoint.y >= 0)
+    {
+        DrawEllipsePoints(framebuffer, centerPoint, symmetryPoint, clipping, color);
+
+        symmetryPoint.y     -= 1;
+        discriminantPoint.y -= 2 * squaredRadius.cx;
+
+        if (discriminant > 0)
+            discriminant += squaredRadius.cx - discriminantPoint.y;
+        else
+        {
+            symmetryPoint.x     += 1;
+            discriminantPoint.x += 2 * squaredRadius.cy;
+            discriminant        += squaredRadius.cx + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+
+    return framebuffer;
+}
+
+// The conic a * X^2 + b * X * Y + c * Y^2 - 4 * d in doubled coordinates, where pixel edges are integers, stepped by additions.
+struct ConicEdge
+{
+    long long squareCoefficient;
+    long long crossCoefficient;
+    long long rowCoefficient;
+    long long edge;
+    long long value;
+    long long slopeX;
+    long long slopeY;
+
+    // Puts the walk at the given edge of the given row, both in doubled coordinates, on the conic with 4 * d = bound.
+    void Place(long long edge, long long row, long long bound)
+    {
+        this->edge = edge;
+        value      = squareCoefficient * edge * edge + crossCoefficient * edge * row + rowCoefficient * row * row - bound;
+        slopeX     = 2 * squareCoefficient * edge + crossCoefficient * row;
+        slopeY     = 2 * rowCoefficient * row + crossCoefficient * edge;
+    }
+
+    void StepRight()
+    {
+        value  += 2 * slopeX + 4 * squareCoefficient;
+        slopeX += 4 * squareCoefficient;
+        slopeY += 2 * crossCoefficient;
+        edge   += 2;
+    }
+
+    void StepLeft()
+    {
+        slopeX -= 4 * squareCoefficient;
+        slopeY -= 2 * crossCoefficient;
+        value  -= 2 * slopeX + 4 * squareCoefficient;
+        edge   -= 2;
+    }
+
+    void StepDown()
+    {
+        value  += 2 * slopeY + 4 * rowCoefficient;
+        slopeY += 4 * rowCoefficient;
+        slopeX += 2 * crossCoefficient;
+    }
+
+    // Inside the ellipse or past the row's lowest value; the test only turns from false to true along a row.
+    bool IsPastCrossing() const
+    {
+        return (value <= 0) | (slopeX >= 0);
+    }
+
+    // The same test on the edge one pixel left, without stepping there.
+    bool IsPreviousPastCrossing() const
+    {
+        return (value - 2 * slopeX + 4 * squareCoefficient <= 0) | (slopeX - 4 * squareCoefficient >= 0);
+    }
+
+    // The pixel the left crossing falls in, walked from the column of the row above.
+    coord_t FindCrossing()
+    {
+        while (IsPastCrossing() == false)
+            StepRight();
+
+        while (IsPreviousPastCrossing() == true)
+            StepLeft();
+
+        return (coord_t)((edge - 1) / 2);
+    }
+};
+
+// Calls rowFunction(y, left, right) with the crossings of the rows below the centre, relative to it; row -y is the mirror.
+// The first row starts from a floating-point solution, and a zero radius is taken as half a pixel.
+template <typename ROWFUNCTION>
+inline void TraceEllipseRows(PixelSize radius, int theta, coord_t firstRow, coord_t lastRow, ROWFUNCTION rowFunction)
+{
+    float        radian            = theta * 3.141592F / 180.0F;
+    double       cosine            = cos(radian);
+    double       sine              = sin(radian);
+    Size<double> squaredRadius     = { std::max((double)radius.cx * radius.cx, 0.25), std::max((double)radius.cy * radius.cy, 0.25) };
+    double       squareCoefficient = squaredRadius.cy * cosine * cosine + squaredRadius.cx * sine * sine;
+    double       crossCoefficient  = 2.0 * cosine * sine * (squaredRadius.cy - squaredRadius.cx);
+    double       rowCoefficient    = squaredRadius.cy * sine * sine + squaredRadius.cx * cosine * cosine;
+    double       bound             = squaredRadius.cx * squaredRadius.cy;
+    double       width             = 2.0 * (sqrt(rowCoefficient) + 2.0);
+    double       height            = 2.0 * (sqrt(squareCoefficient) + 2.0);
+    double       scale;
+    double       root;
+    long long    row;
+    ConicEdge    leftEdge;
+    ConicEdge    rightEdge;
+    int          exponent;
+
+    firstRow = std::max(firstRow, 0);
+    lastRow  = std::min(lastRow, (coord_t)sqrt(squareCoefficient));
+
+    if (firstRow > lastRow)
+        return;
+
+    frexp(16.0 * (squareCoefficient * width * width + fabs(crossCoefficient) * width * height + rowCoefficient * height * height + 4.0 * bound), &exponent);
+
+    scale = ldexp(1.0, 60 - exponent);
+    row   = 2 * (long long)firstRow;
+    root  = sqrt(std::max(crossCoefficient * crossCoefficient * firstRow * firstRow - 4.0 * squareCoefficient * (rowCoefficient * firstRow * firstRow - bound), 0.0));
+
+    leftEdge.squareCoefficient = llround(squareCoefficient * scale);
+    leftEdge.crossCoefficient  = llround(crossCoefficient * scale);
+    leftEdge.rowCoefficient    = llround(rowCoefficient * scale);
+
+    // Mirroring negates the cross term, and the right crossing becomes the mirrored ellipse's left one.
+    rightEdge                  = leftEdge;
+    rightEdge.crossCoefficient = -leftEdge.crossCoefficient;
+
+    leftEdge.Place(2 * (long long)floor((-crossCoefficient * firstRow - root) / (2.0 * squareCoefficient)) + 1, row, 4 * llround(bound * scale));
+    rightEdge.Place(2 * (long long)floor((crossCoefficient * firstRow - root) / (2.0 * squareCoefficient)) + 1, row, 4 * llround(bound * scale));
+
+    for (coord_t y = firstRow; y <= lastRow; ++y)
+    {
+        rowFunction(y, leftEdge.FindCrossing(), -rightEdge.FindCrossing());
+
+        leftEdge.StepDown();
+        rightEdge.StepDown();
+    }
+}
+
+// Calls rowFunction(y, outerLeft, innerLeft, innerRight, outerRight) per outline row; each side reaches halfway to the
+// crossings of the rows next to it, which keeps the outline 8-connected.
+template <typename ROWFUNCTION>
+inline void TraceEllipseOutline(PixelPoint centerPoint, PixelSize radius, int theta, coord_t firstRow, coord_t lastRow, ROWFUNCTION rowFunction)
+{
+    coord_t topRow        = firstRow - centerPoint.y;
+    coord_t bottomRow     = lastRow - centerPoint.y;
+    coord_t nearRow       = (topRow > 0) ? (topRow) : ((bottomRow < 0) ? (-bottomRow) : (0));
+    coord_t farRow        = std::max(-topRow, bottomRow);
+    coord_t row           = 0;
+    bool    hasPrevious   = false;
+    bool    hasCurrent    = false;
+    coord_t previousLeft  = 0;
+    coord_t previousRight = 0;
+    coord_t currentLeft   = 0;
+    coord_t currentRight  = 0;
+
+    auto widenRun = [](coord_t x, coord_t neighbour, coord_t& low, coord_t& high)
+    {
+        low  = std::min(low,  x + (neighbour - x) / 2);
+        high = std::max(high, x + (neighbour - x) / 2);
+    };
+
+    auto emitRow = [&](coord_t y, coord_t outerLeft, coord_t innerLeft, coord_t innerRight, coord_t outerRight)
+    {
+        if (y >= firstRow && y <= lastRow)
+            rowFunction(y, outerLeft, innerLeft, innerRight, outerRight);
+    };
+
+    // The row above the centre row is the reflection of the row below it.
+    auto drawRow = [&](coord_t y, bool hasNext, coord_t nextLeft, coord_t nextRight)
+    {
+        coord_t leftLow   = currentLeft;
+        coord_t leftHigh  = currentLeft;
+        coord_t rightLow  = currentRight;
+        coord_t rightHigh = currentRight;
+
+        if (y < nearRow)
+            return;
+
+        if (y == 0 && hasNext == true)
+        {
+            hasPrevious   = true;
+            previousLeft  = -nextRight;
+            previousRight = -nextLeft;
+        }
+
+        if (hasPrevious == true)
+        {
+            widenRun(currentLeft,  previousLeft,  leftLow,  leftHigh);
+            widenRun(currentRight, previousRight, rightLow, rightHigh);
+        }
+
+        if (hasNext == true)
+        {
+            widenRun(currentLeft,  nextLeft,  leftLow,  leftHigh);
+            widenRun(currentRight, nextRight, rightLow, rightHigh);
+        }
+
+        if (hasPrevious == false || hasNext == false)
+        {
+            leftHigh = rightHigh;
+            rightLow = leftLow;
+        }
+
+        emitRow(centerPoint.y + y, centerPoint.x + leftLow, centerPoint.x + leftHigh, centerPoint.x + rightLow, centerPoint.x + rightHigh);
+
+        if (y != 0)
+            emitRow(centerPoint.y - y, centerPoint.x - rightHigh, centerPoint.x - rightLow, centerPoint.x - leftHigh, centerPoint.x - leftLow);
+    };
+
+    TraceEllipseRows(radius, theta, nearRow - 1, farRow + 1, [&](coord_t y, coord_t left, coord_t right)
+    {
+        if (hasCurrent == true)
+        {
+            drawRow(y - 1, true, left, right);
+
+            hasPrevious   = true;
+            previousLeft  = currentLeft;
+            previousRight = currentRight;
+        }
+
+        hasCurrent   = true;
+        currentLeft  = left;
+        currentRight = right;
+        row          = y;
+    });
+
+    if (hasCurrent == true)
+        drawRow(row, false, 0, 0);
+}
+
+// Multiples of 90 degrees and circles keep to the midpoint outline; any other angle traces the rotated conic.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawEllipse(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelSize radius, int theta, typename FORMAT::ColorType color)
+{
+    int angle = (theta % 180 + 180) % 180;
+
+    if (angle == 0 || radius.cx == radius.cy)
+        return DrawAlignedEllipse(framebuffer, centerPoint, radius, color);
+
+    if (angle == 90)
+        return DrawAlignedEllipse(framebuffer, centerPoint, { radius.cy, radius.cx }, color);
+
+    float     radian   = theta * 3.141592F / 180.0F;
+    PixelSize extent   = { (coord_t)hypot(radius.cx * cos(radian), radius.cy * sin(radian)) + 2, (coord_t)hypot(radius.cx * sin(radian), radius.cy * cos(radian)) + 2 };
+    CLIPPING  clipping = ClipBoundingBox(framebuffer, { centerPoint.x - extent.cx, centerPoint.y - extent.cy, centerPoint.x + extent.cx, centerPoint.y + extent.cy });
+
+    // The rotated extent plus two pixels for rounding.
+    EXECUTION_CONDITION(clipping != CLIPPING::OUTSIDE, framebuffer);
+
+    // Runs are a pixel or two, so plain stores beat FillSpan; rows come clipped already.
+    auto drawRun = [&](coord_t y, coord_t left, coord_t right)
+    {
+        if (clipping == CLIPPING::PARTIAL)
+        {
+            left  = std::max(left, 0);
+            right = std::min(right, framebuffer.GetWidth() - 1);
+
+            if (left > right)
+                return;
+        }
+
+        for (byte_t* pixel = framebuffer.GetPixel(left, y); left <= right; ++left, pixel += FORMAT::CHANNEL_COUNT)
+            FORMAT::Store(pixel, color);
+    };
+
+    TraceEllipseOutline(centerPoint, radius, theta, 0, framebuffer.GetHeight() - 1, [&](coord_t y, coord_t outerLeft, coord_t innerLeft, coord_t innerRight, coord_t outerRight)
+    {
+        if (innerLeft + 1 >= innerRight)
+            drawRun(y, outerLeft, outerRight);
+        else
+        {
+            drawRun(y, outerLeft, innerLeft);
+            drawRun(y, innerRight, outerRight);
+        }
+    });
+
+    return framebuffer;
+}
+
+// Fills the axis-aligned ellipse from DrawAlignedEllipse's midpoint walk, each row once y has moved past it.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& FillAlignedEllipse(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelSize radius, typename FORMAT::ColorType color)
+{
+    Size<long long>  squaredRadius     = { (long long)radius.cx * radius.cx, (long long)radius.cy * radius.cy };
+    PixelPoint       symmetryPoint     = { 0, radius.cy };
+    Point<long long> discriminantPoint = { 0, 2 * squaredRadius.cx * radius.cy };
+    coord_t          row               = radius.cy;
+    coord_t          halfWidth         = 0;
+    long long        discriminant;
+
+    auto fillRows = [&](coord_t rowOffset, coord_t rowHalfWidth)
+    {
+        FillSpan(framebuffer, centerPoint.y + rowOffset, centerPoint.x - rowHalfWidth, centerPoint.x + rowHalfWidth, color);
+
+        if (rowOffset != 0)
+            FillSpan(framebuffer, centerPoint.y - rowOffset, centerPoint.x - rowHalfWidth, centerPoint.x + rowHalfWidth, color);
+    };
+
+    // Rows the outline steps over take the half width of the point below them.
+    auto addPoint = [&](PixelPoint point)
+    {
+        if (point.y == row)
+        {
+            halfWidth = std::max(halfWidth, point.x);
+            return;
+        }
+
+        fillRows(row, halfWidth);
+
+        for (coord_t skippedRow = row - 1; skippedRow > point.y; --skippedRow)
+            fillRows(skippedRow, point.x);
+
+        row       = point.y;
+        halfWidth = point.x;
+    };
+
+    EXECUTION_CONDITION(radius.cx > 0 && radius.cy > 0 && ClipBoundingBox(framebuffer, { centerPoint.x - radius.cx, centerPoint.y - radius.cy, centerPoint.x + radius.cx, centerPoint.y + radius.cy }) != CLIPPING::OUTSIDE, framebuffer);
+
+    discriminant = (long long)(squaredRadius.cy - squaredRadius.cx * radius.cy + 0.25 * squaredRadius.cx + 0.5);
+
+    while (discriminantPoint.x <= discriminantPoint.y)
+    {
+        addPoint(symmetryPoint);
+
+        symmetryPoint.x     += 1;
+        discriminantPoint.x += 2 * squaredRadius.cy;
+
+        if (discriminant < 0)
+            discriminant += squaredRadius.cy + discriminantPoint.x;
+        else
+        {
+            symmetryPoint.y     -= 1;
+            discriminantPoint.y -= 2 * squaredRadius.cx;
+            discriminant        += squaredRadius.cy + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+
+    discriminant = (long long)(squaredRadius.cy * (symmetryPoint.x + 0.5) * (symmetryPoint.x + 0.5) + squaredRadius.cx * (symmetryPoint.y - 1) * (symmetryPoint.y - 1) - squaredRadius.cx * squaredRadius.cy);
+
+    while (symmetryPoint.y >= 0)
+    {
+        addPoint(symmetryPoint);
+
+        symmetryPoint.y     -= 1;
+        discriminantPoint.y -= 2 * squaredRadius.cx;
+
+        if (discriminant > 0)
+            discriminant += squaredRadius.cx - discriminantPoint.y;
+        else
+        {
+            symmetryPoint.x     += 1;
+            discriminantPoint.x += 2 * squaredRadius.cy;
+            discriminant        += squaredRadius.cx + discriminantPoint.x - discriminantPoint.y;
+        }
+    }
+
+    fillRows(row, halfWidth);
+
+    return framebuffer;
+}
+
+// Multiples of 90 degrees and circles keep to the midpoint spans; other angles fill each outline row edge to edge.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& FillEllipse(Framebuffer<FORMAT>& framebuffer, PixelPoint centerPoint, PixelSize radius, int theta, typename FORMAT::ColorType color)
+{
+    int angle = (theta % 180 + 180) % 180;
+
+    if (angle == 0 || radius.cx == radius.cy)
+        return FillAlignedEllipse(framebuffer, centerPoint, radius, color);
+
+    if (angle == 90)
+        return FillAlignedEllipse(framebuffer, centerPoint, { radius.cy, radius.cx }, color);
+
+    EXECUTION_CONDITION(radius.cx > 0 && radius.cy > 0, framebuffer);
+
+    TraceEllipseOutline(centerPoint, radius, theta, 0, framebuffer.GetHeight() - 1, [&](coord_t y, coord_t outerLeft, coord_t, coord_t, coord_t outerRight)
+    {
+        FillSpan(framebuffer, y, outerLeft, outerRight, color);
+    });
+
+    return framebuffer;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "Filled Shapes.h"
+
+static const coord_t IMAGE_WIDTH  = 500;
+static const coord_t IMAGE_HEIGHT = 500;
+
+int main(void)
+{
+    Framebuffer<RGB8> image(IMAGE_WIDTH, IMAGE_HEIGHT);
+    ShapeBatch<RGB8>  batch;
+
+    image.Clear({ 255, 255, 255 });
+
+    batch.AddCircle({ 300, 250 }, 200, { 0, 255, 0 });
+    batch.AddCircle({ 125, 225 }, 150, { 0, 0, 255 });
+    batch.AddCircle({ 150, 150 }, 100, { 255, 0, 0 });
+    batch.AddEllipse({ 150, 400 }, { 100, 40 }, 0,   { 255, 255, 0 });
+    batch.AddEllipse({ 300, 250 }, { 50, 150 }, 75,  { 255, 0, 255 });
+    batch.AddEllipse({ 400, 400 }, { 75, 30 },  120, { 0, 255, 255 });
+
+    FillShapeBatch(image, batch);
+
+    return (WritePXM("Filled Shapes.ppm", image) == true) ? (0) : (1);
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Circle.h"
+#include "Ellipse.h"
+
+enum class SHAPE
+{
+    CIRCLE  = 0,
+    ELLIPSE = 1
+};
+
+// Filled shapes in structure-of-arrays form; a circle keeps its radius in both radii and a theta of 0.
+template <typename FORMAT>
+struct ShapeBatch
+{
+    typedef typename FORMAT::ColorType ColorType;
+
+    std::vector<SHAPE>      shapes;
+    std::vector<PixelPoint> centerPoints;
+    std::vector<PixelSize>  radii;
+    std::vector<int>        thetas;
+    std::vector<ColorType>  colors;
+
+    size_t GetCount() const
+    {
+        return shapes.size();
+    }
+
+    void AddCircle(PixelPoint centerPoint, coord_t radius, ColorType color)
+    {
+        shapes.push_back(SHAPE::CIRCLE);
+        centerPoints.push_back(centerPoint);
+        radii.push_back({ radius, radius });
+        thetas.push_back(0);
+        colors.push_back(color);
+    }
+
+    void AddEllipse(PixelPoint centerPoint, PixelSize radius, int theta, ColorType color)
+    {
+        shapes.push_back(SHAPE::ELLIPSE);
+        centerPoints.push_back(centerPoint);
+        radii.push_back(radius);
+        thetas.push_back(theta);
+        colors.push_back(color);
+    }
+
+    void Clear()
+    {
+        shapes.clear();
+        centerPoints.clear();
+        radii.clear();
+        thetas.clear();
+        colors.clear();
+    }
+};
+
+// Rows are split into bands of this height for the workers.
+static const coord_t SHAPE_BAND_HEIGHT = 64;
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& FillShape(Framebuffer<FORMAT>& framebuffer, const ShapeBatch<FORMAT>& batch, size_t index, coord_t rowOffset)
+{
+    PixelPoint centerPoint = { batch.centerPoints[index].x, batch.centerPoints[index].y - rowOffset };
+
+    if (batch.shapes[index] == SHAPE::CIRCLE)
+        return FillCircle(framebuffer, centerPoint, batch.radii[index].cx, batch.colors[index]);
+
+    return FillEllipse(framebuffer, centerPoint, batch.radii[index], batch.thetas[index], batch.colors[index]);
+}
+
+// Each band draws the shapes reaching into it in batch order, clipped to a framebuffer attached to the band's rows.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& FillShapeBatch(Framebuffer<FORMAT>& framebuffer, const ShapeBatch<FORMAT>& batch, int threadCount = 1)
+{
+    int                  bandCount   = (int)((framebuffer.GetHeight() + SHAPE_BAND_HEIGHT - 1) / SHAPE_BAND_HEIGHT);
+    int                  workerCount = std::max(1, std::min(threadCount, bandCount));
+    std::vector<coord_t> extents;
+
+    if (workerCount == 1)
+    {
+        for (size_t index = 0; index < batch.GetCount(); ++index)
+            FillShape(framebuffer, batch, index, 0);
+
+        return framebuffer;
+    }
+
+    // Half the height of every shape, rounded up and a pixel wider for the midpoint error, to skip it in bands it misses.
+    for (size_t index = 0; index < batch.GetCount(); ++index)
+    {
+        float radian = batch.thetas[index] * 3.141592F / 180.0F;
+
+        extents.push_back((coord_t)ceil(hypot(batch.radii[index].cx * sin(radian), batch.radii[index].cy * cos(radian))) + 1);
+    }
+
+    RunParallelTasks(bandCount, workerCount, [&](int, int band)
+    {
+        coord_t             firstRow = band * SHAPE_BAND_HEIGHT;
+        coord_t             rowCount = std::min(SHAPE_BAND_HEIGHT, framebuffer.GetHeight() - firstRow);
+        Framebuffer<FORMAT> bandFramebuffer;
+
+        bandFramebuffer.Attach(framebuffer.GetPixel(0, firstRow), framebuffer.GetWidth(), rowCount);
+
+        for (size_t index = 0; index < batch.GetCount(); ++index)
+            if (batch.centerPoints[index].y + extents[index] >= firstRow && batch.centerPoints[index].y - extents[index] < firstRow + rowCount)
+                FillShape(bandFramebuffer, batch, index, firstRow);
+    });
+
+    return framebuffer;
+}
\ No newline at end of file
@@ -0,0 +1,314 @@
+#pragma once
+
+#include "Raster.h"
+
+#include <atomic>
+#include <thread>
+
+// x' = a * x + b * y + e, y' = c * x + d * y + f, chosen with probability weight / (sum of weights), as Barnsley writes them.
+struct AffineMap
+{
+    double a, b, c, d, e, f;
+    double weight;
+};
+
+// Bounds are in the maps' own coordinates with y up: top is the largest y and is drawn at the top of the image.
+struct IteratedFunctionSystem
+{
+    std::vector<AffineMap> maps;
+    Rect<double>           bounds;
+};
+
+static const int CHAOS_GAME_WALK_COUNT = 64;
+static const int IFS_LANE_COUNT        = 8;
+static const int IFS_SETTLE_STEPS      = 32;
+
+// Vose's alias method: the high half of one 64-bit number picks a column, the low half its map or that map's alias.
+class AliasTable
+{
+public:
+    explicit AliasTable(const std::vector<AffineMap>& maps)
+    {
+        size_t              mapCount  = maps.size();
+        double              weightSum = 0.0;
+        std::vector<double> probabilities(mapCount);
+        std::vector<int>    smallColumns;
+        std::vector<int>    largeColumns;
+        int                 small;
+        int                 large;
+
+        thresholds.assign(mapCount, 1ULL << 32);
+        aliases.resize(mapCount);
+
+        for (const AffineMap& map : maps)
+            weightSum += map.weight;
+
+        for (size_t index = 0; index < mapCount; ++index)
+        {
+            probabilities[index] = maps[index].weight * mapCount / weightSum;
+            aliases[index]       = (int)index;
+
+            if (probabilities[index] < 1.0)
+                smallColumns.push_back((int)index);
+            else
+                largeColumns.push_back((int)index);
+        }
+
+        while (smallColumns.empty() == false && largeColumns.empty() == false)
+        {
+            small = smallColumns.back();
+            large = largeColumns.back();
+            smallColumns.pop_back();
+
+            thresholds[small]     = (uint64_t)(probabilities[small] * 4294967296.0);
+            aliases[small]        = large;
+            probabilities[large] -= 1.0 - probabilities[small];
+
+            if (probabilities[large] < 1.0)
+            {
+                largeColumns.pop_back();
+                smallColumns.push_back(large);
+            }
+        }
+    }
+
+    int Sample(RandomEngine& randomEngine) const
+    {
+        uint64_t value  = randomEngine();
+        int      column = (int)(((value >> 32) * thresholds.size()) >> 32);
+
+        return ((value & 0xFFFFFFFF) < thresholds[column]) ? (column) : (aliases[column]);
+    }
+
+private:
+    std::vector<uint64_t> thresholds;
+    std::vector<int>      aliases;
+};
+
+inline IteratedFunctionSystem CreateBarnsleyFern()
+{
+    return
+    {
+        {
+            {  0.00,  0.00,  0.00, 0.16, 0.0, 0.00, 0.01 },
+            {  0.85,  0.04, -0.04, 0.85, 0.0, 1.60, 0.85 },
+            {  0.20, -0.26,  0.23, 0.22, 0.0, 1.60, 0.07 },
+            { -0.15,  0.28,  0.26, 0.24, 0.0, 0.44, 0.07 }
+        },
+        { -2.2, 10.0, 2.7, 0.0 }
+    };
+}
+
+inline IteratedFunctionSystem CreateSierpinskiCarpet()
+{
+    IteratedFunctionSystem system = { {}, { 0.0, 1.0, 1.0, 0.0 } };
+
+    for (int row = 0; row < 3; ++row)
+        for (int column = 0; column < 3; ++column)
+            if (row != 1 || column != 1)
+                system.maps.push_back({ 1.0 / 3.0, 0.0, 0.0, 1.0 / 3.0, column / 3.0, row / 3.0, 1.0 });
+
+    return system;
+}
+
+inline IteratedFunctionSystem CreateSierpinskiTriangle()
+{
+    return
+    {
+        {
+            { 0.5, 0.0, 0.0, 0.5, 0.00, 0.0, 1.0 },
+            { 0.5, 0.0, 0.0, 0.5, 0.50, 0.0, 1.0 },
+            { 0.5, 0.0, 0.0, 0.5, 0.25, 0.5, 1.0 }
+        },
+        { 0.0, 1.0, 1.0, 0.0 }
+    };
+}
+
+// For user-defined maps without bounds: the extent of a short walk, widened by a twentieth on every side.
+inline Rect<double> EstimateIFSBounds(const std::vector<AffineMap>& maps, uint64_t seed)
+{
+    AliasTable    aliasTable(maps);
+    RandomEngine  randomEngine(seed);
+    Point<double> point  = { 0.0, 0.0 };
+    Rect<double>  bounds = { DBL_MAX, -DBL_MAX, -DBL_MAX, DBL_MAX };
+    double        marginX;
+    double        marginY;
+
+    for (int step = 0; step < 100000; ++step)
+    {
+        const AffineMap& map = maps[aliasTable.Sample(randomEngine)];
+
+        point = { map.a * point.x + map.b * point.y + map.e, map.c * point.x + map.d * point.y + map.f };
+
+        if (step >= IFS_SETTLE_STEPS)
+            bounds = { std::min(bounds.left, point.x), std::max(bounds.top, point.y), std::max(bounds.right, point.x), std::min(bounds.bottom, point.y) };
+    }
+
+    marginX = std::max(bounds.right - bounds.left, 1e-9) / 20.0;
+    marginY = std::max(bounds.top - bounds.bottom, 1e-9) / 20.0;
+
+    return { bounds.left - marginX, bounds.top + marginY, bounds.right + marginX, bounds.bottom - marginY };
+}
+
+// Each thread counts into a buffer of its own, and the buffers are summed band by band at the end.
+template <typename WALKFUNCTION>
+inline std::vector<uint32_t>& AccumulateHits(std::vector<uint32_t>& hitCounts, size_t pixelCount, int walkCount, int threadCount, WALKFUNCTION walkFunction)
+{
+    int                                workerCount = std::max(1, std::min(threadCount, walkCount));
+    std::vector<std::vector<uint32_t>> threadHitCounts(workerCount - 1);
+    std::atomic<int>                   nextWalk(0);
+    std::vector<std::thread>           workers;
+
+    hitCounts.assign(pixelCount, 0);
+
+    for (int worker = 0; worker < workerCount; ++worker)
+        workers.emplace_back([&, worker]()
+        {
+            uint32_t* workerHitCounts = hitCounts.data();
+
+            if (worker > 0)
+            {
+                threadHitCounts[worker - 1].assign(pixelCount, 0);
+                workerHitCounts = threadHitCounts[worker - 1].data();
+            }
+
+            for (int walk = nextWalk++; walk < walkCount; walk = nextWalk++)
+                walkFunction(workerHitCounts, walk);
+        });
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    workers.clear();
+
+    for (int worker = 0; worker < workerCount && workerCount > 1; ++worker)
+        workers.emplace_back([&, worker]()
+        {
+            size_t firstPixel = pixelCount * worker / workerCount;
+            size_t lastPixel  = pixelCount * (worker + 1) / workerCount;
+
+            for (const std::vector<uint32_t>& counts : threadHitCounts)
+                for (size_t pixel = firstPixel; pixel < lastPixel; ++pixel)
+                    hitCounts[pixel] += counts[pixel];
+        });
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    return hitCounts;
+}
+
+// Advances IFS_LANE_COUNT points at once, gathering the maps into per-lane coefficients so the transform vectorises.
+inline void RunIFSWalk(uint32_t* hitCounts, PixelSize imageSize, const IteratedFunctionSystem& system, const AliasTable& aliasTable, long long steps, RandomEngine& randomEngine)
+{
+    double    scale                  = std::min(imageSize.cx / (system.bounds.right - system.bounds.left), imageSize.cy / (system.bounds.top - system.bounds.bottom));
+    double    originX                = system.bounds.left - (imageSize.cx / scale - (system.bounds.right - system.bounds.left)) / 2.0;
+    double    originY                = system.bounds.top  + (imageSize.cy / scale - (system.bounds.top - system.bounds.bottom)) / 2.0;
+    long long laneSteps              = (steps + IFS_LANE_COUNT - 1) / IFS_LANE_COUNT;
+    double    pointX[IFS_LANE_COUNT] = {};
+    double    pointY[IFS_LANE_COUNT] = {};
+    double    a[IFS_LANE_COUNT];
+    double    b[IFS_LANE_COUNT];
+    double    c[IFS_LANE_COUNT];
+    double    d[IFS_LANE_COUNT];
+    double    e[IFS_LANE_COUNT];
+    double    f[IFS_LANE_COUNT];
+    double    newX;
+    coord_t   pixelX;
+    coord_t   pixelY;
+    int       laneCount;
+
+    for (long long step = -IFS_SETTLE_STEPS; step < laneSteps; ++step)
+    {
+        for (int lane = 0; lane < IFS_LANE_COUNT; ++lane)
+        {
+            const AffineMap& map = system.maps[aliasTable.Sample(randomEngine)];
+
+            a[lane] = map.a;
+            b[lane] = map.b;
+            c[lane] = map.c;
+            d[lane] = map.d;
+            e[lane] = map.e;
+            f[lane] = map.f;
+        }
+
+        for (int lane = 0; lane < IFS_LANE_COUNT; ++lane)
+        {
+            newX         = a[lane] * pointX[lane] + b[lane] * pointY[lane] + e[lane];
+            pointY[lane] = c[lane] * pointX[lane] + d[lane] * pointY[lane] + f[lane];
+            pointX[lane] = newX;
+        }
+
+        if (step < 0)
+            continue;
+
+        // The last step only counts the lanes still owed a point, so exactly steps points land.
+        laneCount = (int)std::min((long long)IFS_LANE_COUNT, steps - step * IFS_LANE_COUNT);
+
+        for (int lane = 0; lane < laneCount; ++lane)
+        {
+            pixelX = (coord_t)floor((pointX[lane] - originX) * scale);
+            pixelY = (coord_t)floor((originY - pointY[lane]) * scale);
+
+            if (CHECK_COORD_VALIDITY(pixelX, pixelY, imageSize.cx, imageSize.cy) == true)
+                hitCounts[(size_t)pixelY * imageSize.cx + pixelX] += 1;
+        }
+    }
+}
+
+inline std::vector<uint32_t>& ComputeIFSHits(std::vector<uint32_t>& hitCounts, PixelSize imageSize, const IteratedFunctionSystem& system, long long steps, uint64_t seed, int threadCount)
+{
+    AliasTable                aliasTable(system.maps);
+    std::vector<RandomEngine> randomEngines;
+    RandomEngine              randomEngine(seed);
+
+    for (int walk = 0; walk < CHAOS_GAME_WALK_COUNT; ++walk)
+    {
+        randomEngines.push_back(randomEngine);
+        randomEngine.Jump();
+    }
+
+    return AccumulateHits(hitCounts, (size_t)imageSize.cx * imageSize.cy, CHAOS_GAME_WALK_COUNT, threadCount, [&](uint32_t* workerHitCounts, int walk)
+    {
+        RunIFSWalk(workerHitCounts, imageSize, system, aliasTable, steps / CHAOS_GAME_WALK_COUNT + ((walk < steps % CHAOS_GAME_WALK_COUNT) ? (1) : (0)), randomEngines[walk]);
+    });
+}
+
+// Log scaling keeps a pixel hit once visible next to ones hit millions of times.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& ToneMapHitCounts(Framebuffer<FORMAT>& framebuffer, const uint32_t* hitCounts, typename FORMAT::ColorType color)
+{
+    size_t   pixelCount = (size_t)framebuffer.GetWidth() * framebuffer.GetHeight();
+    uint32_t maxCount   = (pixelCount > 0) ? (*std::max_element(hitCounts, hitCounts + pixelCount)) : (0);
+    byte_t   colorLevels[FORMAT::CHANNEL_COUNT];
+    byte_t*  pixel;
+    double   density;
+
+    EXECUTION_CONDITION(maxCount > 0, framebuffer);
+
+    FORMAT::Store(colorLevels, color);
+
+    for (size_t index = 0; index < pixelCount; ++index)
+    {
+        if (hitCounts[index] == 0)
+            continue;
+
+        pixel   = framebuffer.GetData() + index * FORMAT::CHANNEL_COUNT;
+        density = log1p((double)hitCounts[index]) / log1p((double)maxCount);
+
+        for (int channel = 0; channel < FORMAT::CHANNEL_COUNT; ++channel)
+            pixel[channel] = (byte_t)(pixel[channel] + (colorLevels[channel] - pixel[channel]) * density + 0.5);
+    }
+
+    return framebuffer;
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawIFS(Framebuffer<FORMAT>& framebuffer, const IteratedFunctionSystem& system, long long steps, typename FORMAT::ColorType color, uint64_t seed, int threadCount)
+{
+    std::vector<uint32_t> hitCounts;
+
+    ComputeIFSHits(hitCounts, framebuffer.GetSize(), system, steps, seed, threadCount);
+
+    return ToneMapHitCounts(framebuffer, hitCounts.data(), color);
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Wu Line.h"
+
+#include <vector>
+
+static const int    KOCH_THETA  = 60;
+static const double KOCH_COSINE = cos(KOCH_THETA * 3.14159265358979323846 / 180.0);
+static const double KOCH_SINE   = sin(KOCH_THETA * 3.14159265358979323846 / 180.0);
+
+// Every step turns each segment into four, so the closed snowflake has 3 * 4^steps segments and one more vertex.
+inline size_t GetKochVertexCount(int steps)
+{
+    return 3 * ((size_t)1 << (2 * steps)) + 1;
+}
+
+// Replaces the segment from startPoint to endPoint by the four of the Koch rule, writing the three new vertices.
+inline void SubdivideKochSegment(Point<double> startPoint, Point<double> endPoint, Point<double>& point1, Point<double>& point2, Point<double>& point3)
+{
+    Point<double> third = { (endPoint.x - startPoint.x) * (1.0 / 3.0), (endPoint.y - startPoint.y) * (1.0 / 3.0) };
+
+    point1 = { startPoint.x + third.x,       startPoint.y + third.y };
+    point3 = { startPoint.x + 2.0 * third.x, startPoint.y + 2.0 * third.y };
+    point2 = { point3.x + (point1.x - point3.x) * KOCH_COSINE - (point1.y - point3.y) * KOCH_SINE, point3.y + (point1.x - point3.x) * KOCH_SINE + (point1.y - point3.y) * KOCH_COSINE };
+}
+
+inline PixelPoint RoundKochPoint(Point<double> point)
+{
+    return { (coord_t)floor(point.x + 0.5), (coord_t)floor(point.y + 0.5) };
+}
+
+// Allocates every vertex once and subdivides in place, each step filling the vertices midway between existing ones.
+inline std::vector<Point<double>>& GenerateKochCurve(std::vector<Point<double>>& points, PixelPoint point1, PixelPoint point2, PixelPoint point3, int steps)
+{
+    size_t stride = (size_t)1 << (2 * steps);
+
+    points.resize(GetKochVertexCount(steps));
+
+    points[0]          = { (double)point1.x, (double)point1.y };
+    points[stride]     = { (double)point2.x, (double)point2.y };
+    points[2 * stride] = { (double)point3.x, (double)point3.y };
+    points[3 * stride] = points[0];
+
+    for (; stride > 1; stride /= 4)
+        for (size_t index = 0; index + stride < points.size(); index += stride)
+            SubdivideKochSegment(points[index], points[index + stride], points[index + stride / 4], points[index + stride / 2], points[index + stride / 4 * 3]);
+
+    return points;
+}
+
+// Emits the segments in curve order without storing them, so memory grows with steps and not with 4^steps.
+template <typename SEGMENTFUNCTION>
+inline void EmitKochSegments(Point<double> startPoint, Point<double> endPoint, int steps, SEGMENTFUNCTION& segmentFunction)
+{
+    Point<double> points[5] = { startPoint, {}, {}, {}, endPoint };
+
+    if (steps == 0)
+    {
+        segmentFunction(startPoint, endPoint);
+        return;
+    }
+
+    SubdivideKochSegment(startPoint, endPoint, points[1], points[2], points[3]);
+
+    for (int index = 0; index < 4; ++index)
+        EmitKochSegments(points[index], points[index + 1], steps - 1, segmentFunction);
+}
+
+// Segments whose ends round to one pixel are skipped, and each line starts from the last pixel drawn.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawKochCurve(Framebuffer<FORMAT>& framebuffer, PixelPoint point1, PixelPoint point2, PixelPoint point3, int steps, typename FORMAT::ColorType color, LINEMODE lineMode = LINEMODE::ALIASED)
+{
+    Point<double> corners[4] = { { (double)point1.x, (double)point1.y }, { (double)point2.x, (double)point2.y }, { (double)point3.x, (double)point3.y }, { (double)point1.x, (double)point1.y } };
+    PixelPoint    lastPoint  = point1;
+    PixelPoint    endPixel;
+
+    auto segmentFunction = [&](Point<double>, Point<double> endPoint)
+    {
+        endPixel = RoundKochPoint(endPoint);
+
+        if (endPixel.x == lastPoint.x && endPixel.y == lastPoint.y)
+            return;
+
+        DrawLine(framebuffer, lastPoint, endPixel, color, lineMode);
+        lastPoint = endPixel;
+    };
+
+    SetPixel(framebuffer, point1, color);
+
+    for (int index = 0; index < 3; ++index)
+        EmitKochSegments(corners[index], corners[index + 1], steps, segmentFunction);
+
+    return framebuffer;
+}
\ No newline at end of file
@@ -1,27 +1,21 @@
-#include <Windows.h>
+#include "Mandelbrot.h"
 
-#include <algorithm>
-#include <cinttypes>
-#include <cmath>
-#include <tuple>
-#include <vector>
+#include <chrono>
 
-#include <glut.h>
-
-#ifndef GLOBAL_VARIABLE
-    #define GLOBAL_VARIABLE(variable) (variable)
+#if defined(_WIN32)
+    #include <glut.h>
+#else
+    #include <GL/glut.h>
 #endif
 
-#ifndef SAFE_DELETE
-    #define SAFE_DELETE(pointer) { if (pointer != nullptr) delete[] pointer; pointer = nullptr; }
+#ifndef GLUTCALLBACK
+    #define GLUTCALLBACK
 #endif
 
-#ifndef CHECK_COORD_VALIDITY
-    #define CHECK_COORD_VALIDITY(x, y, width, height) (x >= 0 && y >= 0 && x < width && y < height)
+#ifndef GLOBAL_VARIABLE
+    #define GLOBAL_VARIABLE(variable) (variable)
 #endif
 
-typedef uint8_t byte_t;
-
 enum class MOUSEBUTTON
 {
     LEFT_BUTTON   = 0,
@@ -29,86 +23,290 @@ enum class MOUSEBUTTON
     RIGHT_BUTTON  = 2
 };
 
-struct ComplexNumber
+static const PixelPoint WINDOW_COORD   = { 0,    0    };
+static const PixelSize  WINDOW_SIZE    = { 500,  500  };
+static const PixelSize  BENCHMARK_SIZE = { 2048, 2048 };
+
+class TexturePresenter : public ImagePresenter
 {
-    double realNumber;
-    double imaginaryNumber;
-};
+public:
+    explicit TexturePresenter(PixelSize imageSize) : imageSize(imageSize), textureSize({ 1, 1 }), texture(0)
+    {
+        // Power-of-two storage keeps this working on OpenGL 1.1, the image only fills its lower-left corner.
+        while (textureSize.cx < imageSize.cx)
+            textureSize.cx *= 2;
+
+        while (textureSize.cy < imageSize.cy)
+            textureSize.cy *= 2;
+
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, textureSize.cx, textureSize.cy, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, nullptr);
+    }
 
-static const COORD WINDOW_COORD  = { 0,   0   };
-static const SIZE  WINDOW_SIZE   = { 500, 500 };
-static const int   MAX_ITERATION = 100;
+    ~TexturePresenter() override
+    {
+        glDeleteTextures(1, &texture);
+    }
 
-byte_t*                    GLOBAL_VARIABLE(image);
-RECT                       GLOBAL_VARIABLE(zoomArea);
+    void Upload(const Framebuffer<Gray8>& image) override
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, imageSize.cx, imageSize.cy, GL_LUMINANCE, GL_UNSIGNED_BYTE, image.GetData());
+    }
+
+    void Present(PixelRectangle zoomArea) override
+    {
+        float textureRight = imageSize.cx / (float)textureSize.cx;
+        float textureTop   = imageSize.cy / (float)textureSize.cy;
+
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, texture);
+
+        glBegin(GL_QUADS);
+            glColor3f(1.0F, 1.0F, 1.0F);
+            glTexCoord2f(0.0F,         0.0F);       glVertex3f(0.0F, 0.0F, 0.0F);
+            glTexCoord2f(textureRight, 0.0F);       glVertex3f(1.0F, 0.0F, 0.0F);
+            glTexCoord2f(textureRight, textureTop); glVertex3f(1.0F, 1.0F, 0.0F);
+            glTexCoord2f(0.0F,         textureTop); glVertex3f(0.0F, 1.0F, 0.0F);
+        glEnd();
+
+        glDisable(GL_TEXTURE_2D);
+
+        glBegin(GL_LINE_LOOP);
+            glColor3f(1.0F, 0.0F, 0.0F);
+            glVertex3f(zoomArea.left  / (float)imageSize.cx, (imageSize.cy - zoomArea.top)    / (float)imageSize.cy, 0.0F);
+            glVertex3f(zoomArea.left  / (float)imageSize.cx, (imageSize.cy - zoomArea.bottom) / (float)imageSize.cy, 0.0F);
+            glVertex3f(zoomArea.right / (float)imageSize.cx, (imageSize.cy - zoomArea.bottom) / (float)imageSize.cy, 0.0F);
+            glVertex3f(zoomArea.right / (float)imageSize.cx, (imageSize.cy - zoomArea.top)    / (float)imageSize.cy, 0.0F);
+        glEnd();
+    }
+
+private:
+    PixelSize imageSize;
+    PixelSize textureSize;
+    GLuint    texture;
+};
+
+Framebuffer<Gray8>         GLOBAL_VARIABLE(image);
+int*                       GLOBAL_VARIABLE(iterationImage);
+ImagePresenter*            GLOBAL_VARIABLE(presenter);
+PixelRectangle             GLOBAL_VARIABLE(zoomArea);
+PixelPoint                 GLOBAL_VARIABLE(panOrigin);
 MOUSEBUTTON                GLOBAL_VARIABLE(mouseButton);
+MandelbrotOption           GLOBAL_VARIABLE(mandelbrotOption);
+IterationCache             GLOBAL_VARIABLE(iterationCache);
+int                        GLOBAL_VARIABLE(refinementStep);
 
-std::tuple<double, double> GLOBAL_VARIABLE(mandelbrotViewport);
-std::tuple<double, double> GLOBAL_VARIABLE(mandelbrotCenter);
+std::tuple<double, double>               GLOBAL_VARIABLE(mandelbrotViewport);
+std::tuple<double, double>               GLOBAL_VARIABLE(mandelbrotCenter);
+std::tuple<PreciseNumber, PreciseNumber> GLOBAL_VARIABLE(mandelbrotPreciseCenter);
 
-byte_t* DrawMandelbrot(byte_t* image, SIZE imageSize, std::tuple<double, double> center, std::tuple<double, double> viewport)
+double MeasureMandelbrot(Framebuffer<Gray8>& image, int* iterationImage, MandelbrotOption option, MandelbrotStatistics* statistics = nullptr)
 {
-    ComplexNumber    complexNumber;
-    ComplexNumber    recurrenceRelation[2];
+    std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
 
-    int              iteration;
-    int              correctedMaxIteration;
+    DrawMandelbrot(image, iterationImage, std::make_tuple(-0.5, 0.0), std::make_tuple(2.0, 2.0), option, statistics);
 
-    std::vector<int> iterationImage;
-    double           iterationMin;
-    double           iterationMax;
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
 
-    correctedMaxIteration  = MAX_ITERATION;
-    correctedMaxIteration += 10 * (int)((1.0 - log10(std::get<0>(viewport))) / log10(2.0));
+double MeasureMandelbrotDeep(Framebuffer<Gray8>& image, int* iterationImage, std::tuple<double, double> viewport, MandelbrotOption option)
+{
+    std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
 
-    for (int iy = 0; iy < imageSize.cy; ++iy)
-        for (int ix = 0; ix < imageSize.cx; ++ix)
-        {
-            if (CHECK_COORD_VALIDITY(ix, iy, imageSize.cx, imageSize.cy) == false)
-                continue;
+    DrawMandelbrotDeep(image, iterationImage, std::make_tuple(PreciseNumber(0.0), PreciseNumber(1.0)), viewport, option);
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
 
-            complexNumber.realNumber      = ix * std::get<0>(viewport) / (imageSize.cx - 1) - std::get<0>(viewport) / 2.0 + std::get<0>(center);
-            complexNumber.imaginaryNumber = iy * std::get<1>(viewport) / (imageSize.cy - 1) - std::get<1>(viewport) / 2.0 + std::get<1>(center);
+double MeasureMandelbrotProgressive(Framebuffer<Gray8>& image, int* iterationImage, std::tuple<double, double> center, std::tuple<double, double> viewport, MandelbrotOption option, int sampleStep, IterationCache& cache, MandelbrotStatistics* statistics)
+{
+    std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
 
-            recurrenceRelation[0].realNumber      = 0.0;
-            recurrenceRelation[0].imaginaryNumber = 0.0;
+    DrawMandelbrotProgressive(image, iterationImage, center, viewport, option, sampleStep, cache, statistics);
 
-            recurrenceRelation[1].realNumber      = 0.0;
-            recurrenceRelation[1].imaginaryNumber = 0.0;
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
 
-            for (iteration = 0; iteration < correctedMaxIteration; ++iteration)
-            {
-                recurrenceRelation[0].realNumber      = recurrenceRelation[1].realNumber;
-                recurrenceRelation[0].imaginaryNumber = recurrenceRelation[1].imaginaryNumber;
+long long CountDifferingPixels(const Framebuffer<Gray8>& image, const Framebuffer<Gray8>& referenceImage)
+{
+    long long differingCount = 0;
+
+    for (size_t index = 0; index < image.GetByteCount(); ++index)
+        differingCount += (image.GetData()[index] != referenceImage.GetData()[index]) ? (1) : (0);
+
+    return differingCount;
+}
+
+void BenchmarkMandelbrot()
+{
+    Framebuffer<Gray8>   referenceImage(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<Gray8>   image(BENCHMARK_SIZE.cx, BENCHMARK_SIZE.cy);
+    Framebuffer<RGB8>    overlayImage;
+    int*                 iterationImage = new int[BENCHMARK_SIZE.cx * BENCHMARK_SIZE.cy];
+    MandelbrotOption     option         = GetDefaultMandelbrotOption();
+    MandelbrotStatistics statistics;
+    IterationCache       cache;
+    double               scalarTime;
+    double               serialTime;
+    double               elapsedTime;
+
+    scalarTime = MeasureMandelbrot(referenceImage, iterationImage, { 1, SIMDINSTRUCTION::SCALAR, MANDELBROTSOLVER::BRUTE_FORCE });
+
+    printf("%10s %12s %8s %10s\n", "Kernel", "Time (ms)", "Speedup", "Identical");
+    printf("%10s %12.2f %8.2f %10s\n", SIMD_INSTRUCTION_NAMES[0], scalarTime, 1.0, "yes");
+
+    for (int simdInstruction = 1; simdInstruction <= (int)option.simdInstruction; ++simdInstruction)
+    {
+        elapsedTime = MeasureMandelbrot(image, iterationImage, { 1, (SIMDINSTRUCTION)simdInstruction, MANDELBROTSOLVER::BRUTE_FORCE });
+
+        printf("%10s %12.2f %8.2f %10s\n", SIMD_INSTRUCTION_NAMES[simdInstruction], elapsedTime, scalarTime / elapsedTime, (memcmp(image.GetData(), referenceImage.GetData(), image.GetByteCount()) == 0) ? ("yes") : ("no"));
+    }
+
+    serialTime = MeasureMandelbrot(image, iterationImage, { 1, option.simdInstruction, MANDELBROTSOLVER::BRUTE_FORCE });
+
+    printf("\n%10s %12s %8s %10s\n", "Threads", "Time (ms)", "Speedup", "Identical");
+    printf("%10d %12.2f %8.2f %10s\n", 1, serialTime, 1.0, (memcmp(image.GetData(), referenceImage.GetData(), image.GetByteCount()) == 0) ? ("yes") : ("no"));
+
+    for (int threadCount = 2; threadCount <= option.threadCount; threadCount *= 2)
+    {
+        elapsedTime = MeasureMandelbrot(image, iterationImage, { threadCount, option.simdInstruction, MANDELBROTSOLVER::BRUTE_FORCE });
+
+        printf("%10d %12.2f %8.2f %10s\n", threadCount, elapsedTime, serialTime / elapsedTime, (memcmp(image.GetData(), referenceImage.GetData(), image.GetByteCount()) == 0) ? ("yes") : ("no"));
+    }
+
+    // Mariani-Silver can fill over an escape channel narrower than a pixel, so it reports the pixels it gets wrong.
+    printf("\n%16s %12s %8s %16s %10s\n", "Solver", "Time (ms)", "Speedup", "Iterated Pixels", "Differing");
+
+    for (int solver = 0; solver <= (int)MANDELBROTSOLVER::MARIANI_SILVER; ++solver)
+    {
+        elapsedTime = MeasureMandelbrot(image, iterationImage, { option.threadCount, option.simdInstruction, (MANDELBROTSOLVER)solver }, &statistics);
+
+        printf("%16s %12.2f %8.2f %16lld %10lld\n", MANDELBROT_SOLVER_NAMES[solver], elapsedTime, serialTime / elapsedTime, statistics.iteratedPixelCount, CountDifferingPixels(image, referenceImage));
+    }
+
+    image.Resize(WINDOW_SIZE.cx, WINDOW_SIZE.cy);
+    referenceImage.Resize(WINDOW_SIZE.cx, WINDOW_SIZE.cy);
+
+    printf("\n%10s %12s %10s\n", "Zoom", "Time (ms)", "Iteration");
+
+    for (double zoom = 1e-20; zoom >= 1e-80; zoom *= 1e-20)
+    {
+        elapsedTime = MeasureMandelbrotDeep(image, iterationImage, std::make_tuple(zoom, zoom), option);
+
+        printf("%10.0e %12.2f %10d\n", zoom, elapsedTime, GetCorrectedMaxIteration(std::make_tuple(zoom, zoom)));
+    }
 
-                recurrenceRelation[1].realNumber      = recurrenceRelation[0].realNumber * recurrenceRelation[0].realNumber - recurrenceRelation[0].imaginaryNumber * recurrenceRelation[0].imaginaryNumber + complexNumber.realNumber;
-                recurrenceRelation[1].imaginaryNumber = 2.0 * recurrenceRelation[0].realNumber * recurrenceRelation[0].imaginaryNumber + complexNumber.imaginaryNumber;
+    const char*                navigationNames[4]     = { "Initial", "Pan", "Zoom", "Return" };
+    std::tuple<double, double> navigationCenters[4]   = { std::make_tuple(-0.5, 0.0), std::make_tuple(-0.5 + 60 * 2.0 / (WINDOW_SIZE.cx - 1), 40 * 2.0 / (WINDOW_SIZE.cy - 1)), std::make_tuple(-0.5 + 60 * 2.0 / (WINDOW_SIZE.cx - 1), 40 * 2.0 / (WINDOW_SIZE.cy - 1)), std::make_tuple(-0.5, 0.0) };
+    std::tuple<double, double> navigationViewports[4] = { std::make_tuple(2.0, 2.0),  std::make_tuple(2.0, 2.0), std::make_tuple(1.0, 1.0), std::make_tuple(2.0, 2.0) };
 
-                if (recurrenceRelation[1].realNumber * recurrenceRelation[1].realNumber + recurrenceRelation[1].imaginaryNumber * recurrenceRelation[1].imaginaryNumber > 4.0)
-                    break;
-            }
+    printf("\n%10s %12s %12s %12s %16s %14s %12s\n", "Navigation", "Preview (ms)", "Refine (ms)", "Scratch (ms)", "Iterated Pixels", "Cached Pixels", "Mismatches");
 
-            iterationImage.push_back(iteration);
+    for (int navigation = 0; navigation < 4; ++navigation)
+    {
+        long long iteratedPixelCount = 0;
+        long long cachedPixelCount   = 0;
+        long long mismatchCount      = 0;
+        double    previewTime        = 0.0;
+        double    refineTime         = 0.0;
+        double    scratchTime;
+
+        for (int sampleStep = PREVIEW_STEP; sampleStep >= 1; sampleStep /= 2)
+        {
+            elapsedTime = MeasureMandelbrotProgressive(image, iterationImage, navigationCenters[navigation], navigationViewports[navigation], option, sampleStep, cache, &statistics);
+
+            if (sampleStep == PREVIEW_STEP)
+                previewTime = elapsedTime;
+            else
+                refineTime += elapsedTime;
+
+            iteratedPixelCount += statistics.iteratedPixelCount;
+            cachedPixelCount   += statistics.cachedPixelCount;
         }
 
-    iterationMin = (double)iterationImage[std::min_element(iterationImage.begin(), iterationImage.end()) - iterationImage.begin()];
-    iterationMax = (double)iterationImage[std::max_element(iterationImage.begin(), iterationImage.end()) - iterationImage.begin()];
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        DrawMandelbrot(referenceImage, iterationImage + WINDOW_SIZE.cx * WINDOW_SIZE.cy, navigationCenters[navigation], navigationViewports[navigation], option);
+        scratchTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        for (size_t index = 0; index < image.GetByteCount(); ++index)
+            mismatchCount += (image.GetData()[index] != referenceImage.GetData()[index]) ? (1) : (0);
+
+        printf("%10s %12.2f %12.2f %12.2f %16lld %14lld %12lld\n", navigationNames[navigation], previewTime, refineTime, scratchTime, iteratedPixelCount, cachedPixelCount, mismatchCount);
+    }
+
+    // A drag redraws once per motion event; with the frame already handed over, none of them touches the fractal.
+    MemoryPresenter presenter(WINDOW_SIZE);
+    long long       overlayPixelCount = 0;
+
+    presenter.Upload(image);
+
+    for (coord_t offset = 0; offset < WINDOW_SIZE.cx / 2; ++offset)
+        presenter.Present({ 100, 100, 100 + offset, 100 + offset });
+
+    presenter.Snapshot(overlayImage);
 
-    for (int index = 0; index < (int)iterationImage.size(); ++index)
-        image[index] = (int)((iterationMax - iterationImage[index]) * 255.0 / (iterationMax - iterationMin) + 0.5);
+    for (coord_t y = 0; y < overlayImage.GetHeight(); ++y)
+        for (coord_t x = 0; x < overlayImage.GetWidth(); ++x)
+            overlayPixelCount += (overlayImage.GetPixel(x, y)[0] != overlayImage.GetPixel(x, y)[1]) ? (1) : (0);
+
+    printf("\n%10s %10s %16s %16s\n", "Redraws", "Uploads", "Uploaded Bytes", "Overlay Pixels");
+    printf("%10d %10d %16lld %16lld\n", presenter.GetPresentCount(), presenter.GetUploadCount(), (long long)presenter.GetUploadCount() * WINDOW_SIZE.cx * WINDOW_SIZE.cy, overlayPixelCount);
+
+    SAFE_DELETE(iterationImage);
+}
+
+void RefineMandelbrot(int sampleStep)
+{
+    GLOBAL_VARIABLE(refinementStep) = sampleStep;
+
+    DrawMandelbrotProgressive(GLOBAL_VARIABLE(image), GLOBAL_VARIABLE(iterationImage), GLOBAL_VARIABLE(mandelbrotCenter), GLOBAL_VARIABLE(mandelbrotViewport), GLOBAL_VARIABLE(mandelbrotOption), sampleStep, GLOBAL_VARIABLE(iterationCache));
+    GLOBAL_VARIABLE(presenter)->Upload(GLOBAL_VARIABLE(image));
+}
+
+void GLUTCALLBACK IdleCallback()
+{
+    RefineMandelbrot(GLOBAL_VARIABLE(refinementStep) / 2);
+
+    if (GLOBAL_VARIABLE(refinementStep) == 1)
+        glutIdleFunc(nullptr);
+
+    glutPostRedisplay();
+}
 
-    return image;
+void UpdateMandelbrot()
+{
+    if (std::get<0>(GLOBAL_VARIABLE(mandelbrotViewport)) < DEEP_ZOOM_THRESHOLD)
+    {
+        glutIdleFunc(nullptr);
+        DrawMandelbrotDeep(GLOBAL_VARIABLE(image), GLOBAL_VARIABLE(iterationImage), GLOBAL_VARIABLE(mandelbrotPreciseCenter), GLOBAL_VARIABLE(mandelbrotViewport), GLOBAL_VARIABLE(mandelbrotOption));
+        GLOBAL_VARIABLE(presenter)->Upload(GLOBAL_VARIABLE(image));
+    }
+    else
+    {
+        RefineMandelbrot(PREVIEW_STEP);
+        glutIdleFunc(IdleCallback);
+    }
 }
 
 void InitializeGlobalVariables()
 {
-    GLOBAL_VARIABLE(image) = new byte_t[WINDOW_SIZE.cx * WINDOW_SIZE.cy];
-    memset(GLOBAL_VARIABLE(image), 255, sizeof(byte_t) * WINDOW_SIZE.cx * WINDOW_SIZE.cy);
+    GLOBAL_VARIABLE(image).Resize(WINDOW_SIZE.cx, WINDOW_SIZE.cy);
+    GLOBAL_VARIABLE(image).Clear(255);
+
+    GLOBAL_VARIABLE(iterationImage) = new int[WINDOW_SIZE.cx * WINDOW_SIZE.cy];
+    GLOBAL_VARIABLE(presenter)      = new TexturePresenter(WINDOW_SIZE);
 
-    GLOBAL_VARIABLE(mandelbrotViewport) = std::make_tuple(2.0F,  2.0F);
-    GLOBAL_VARIABLE(mandelbrotCenter)   = std::make_tuple(-0.5F, 0.0F);
+    GLOBAL_VARIABLE(mandelbrotViewport)      = std::make_tuple(2.0F,  2.0F);
+    GLOBAL_VARIABLE(mandelbrotCenter)        = std::make_tuple(-0.5F, 0.0F);
+    GLOBAL_VARIABLE(mandelbrotPreciseCenter) = std::make_tuple(PreciseNumber(-0.5), PreciseNumber(0.0));
 
-    DrawMandelbrot(GLOBAL_VARIABLE(image), WINDOW_SIZE, GLOBAL_VARIABLE(mandelbrotCenter), GLOBAL_VARIABLE(mandelbrotViewport));
+    UpdateMandelbrot();
 }
 
 void InitializeGlut()
@@ -125,21 +323,7 @@ void GLUTCALLBACK DisplayCallback()
     glViewport(0, 0, WINDOW_SIZE.cx, WINDOW_SIZE.cy);
     glClear(GL_COLOR_BUFFER_BIT);
 
-    glBegin(GL_POINTS);
-        for (int index = 0; index < WINDOW_SIZE.cx * WINDOW_SIZE.cy; ++index)
-        {
-            glColor3ub(GLOBAL_VARIABLE(image)[index], GLOBAL_VARIABLE(image)[index], GLOBAL_VARIABLE(image)[index]);
-            glVertex3f((index % WINDOW_SIZE.cx) / (float)WINDOW_SIZE.cx, (index / WINDOW_SIZE.cx) / (float)WINDOW_SIZE.cy, 0.0F);
-        }
-    glEnd();
-
-    glBegin(GL_LINE_LOOP);
-        glColor3f(1.0F, 0.0F, 0.0F);
-        glVertex3f(GLOBAL_VARIABLE(zoomArea).left  / (float)WINDOW_SIZE.cx, (WINDOW_SIZE.cy - GLOBAL_VARIABLE(zoomArea.top))    / (float)WINDOW_SIZE.cy, 0.0F);
-        glVertex3f(GLOBAL_VARIABLE(zoomArea).left  / (float)WINDOW_SIZE.cx, (WINDOW_SIZE.cy - GLOBAL_VARIABLE(zoomArea.bottom)) / (float)WINDOW_SIZE.cy, 0.0F);
-        glVertex3f(GLOBAL_VARIABLE(zoomArea).right / (float)WINDOW_SIZE.cx, (WINDOW_SIZE.cy - GLOBAL_VARIABLE(zoomArea.bottom)) / (float)WINDOW_SIZE.cy, 0.0F);
-        glVertex3f(GLOBAL_VARIABLE(zoomArea).right / (float)WINDOW_SIZE.cx, (WINDOW_SIZE.cy - GLOBAL_VARIABLE(zoomArea.top))    / (float)WINDOW_SIZE.cy, 0.0F);
-    glEnd();
+    GLOBAL_VARIABLE(presenter)->Present(GLOBAL_VARIABLE(zoomArea));
 
     glutSwapBuffers();
 }
@@ -151,7 +335,8 @@ void GLUTCALLBACK ReshapeCallback(GLint width, GLint height)
 
 void GLUTCALLBACK MouseCallback(GLint button, GLint state, GLint x, GLint y)
 {
-    double majorAxisLength;
+    double        majorAxisLength;
+    ComplexNumber centerOffset;
 
     switch (button)
     {
@@ -168,14 +353,20 @@ void GLUTCALLBACK MouseCallback(GLint button, GLint state, GLint x, GLint y)
             else
                 majorAxisLength = abs(GLOBAL_VARIABLE(zoomArea).bottom - GLOBAL_VARIABLE(zoomArea).top);
 
-            std::get<0>(GLOBAL_VARIABLE(mandelbrotCenter)) = std::get<0>(GLOBAL_VARIABLE(mandelbrotCenter)) - (WINDOW_SIZE.cx / 2.0F - (GLOBAL_VARIABLE(zoomArea).left + GLOBAL_VARIABLE(zoomArea).right)  / 2.0F) * std::get<0>(GLOBAL_VARIABLE(mandelbrotViewport)) / WINDOW_SIZE.cx;
-            std::get<1>(GLOBAL_VARIABLE(mandelbrotCenter)) = std::get<1>(GLOBAL_VARIABLE(mandelbrotCenter)) + (WINDOW_SIZE.cy / 2.0F - (GLOBAL_VARIABLE(zoomArea).top  + GLOBAL_VARIABLE(zoomArea).bottom) / 2.0F) * std::get<1>(GLOBAL_VARIABLE(mandelbrotViewport)) / WINDOW_SIZE.cy;
+            centerOffset.realNumber      = -(WINDOW_SIZE.cx / 2.0F - (GLOBAL_VARIABLE(zoomArea).left + GLOBAL_VARIABLE(zoomArea).right)  / 2.0F) * std::get<0>(GLOBAL_VARIABLE(mandelbrotViewport)) / WINDOW_SIZE.cx;
+            centerOffset.imaginaryNumber =  (WINDOW_SIZE.cy / 2.0F - (GLOBAL_VARIABLE(zoomArea).top  + GLOBAL_VARIABLE(zoomArea).bottom) / 2.0F) * std::get<1>(GLOBAL_VARIABLE(mandelbrotViewport)) / WINDOW_SIZE.cy;
+
+            std::get<0>(GLOBAL_VARIABLE(mandelbrotCenter)) = std::get<0>(GLOBAL_VARIABLE(mandelbrotCenter)) + centerOffset.realNumber;
+            std::get<1>(GLOBAL_VARIABLE(mandelbrotCenter)) = std::get<1>(GLOBAL_VARIABLE(mandelbrotCenter)) + centerOffset.imaginaryNumber;
+
+            std::get<0>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) = std::get<0>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) + PreciseNumber(centerOffset.realNumber);
+            std::get<1>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) = std::get<1>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) + PreciseNumber(centerOffset.imaginaryNumber);
 
             std::get<0>(GLOBAL_VARIABLE(mandelbrotViewport)) = majorAxisLength * std::get<0>(GLOBAL_VARIABLE(mandelbrotViewport)) / WINDOW_SIZE.cx;
             std::get<1>(GLOBAL_VARIABLE(mandelbrotViewport)) = majorAxisLength * std::get<1>(GLOBAL_VARIABLE(mandelbrotViewport)) / WINDOW_SIZE.cy;
 
-            DrawMandelbrot(GLOBAL_VARIABLE(image), WINDOW_SIZE, GLOBAL_VARIABLE(mandelbrotCenter), GLOBAL_VARIABLE(mandelbrotViewport));
-            memset(&GLOBAL_VARIABLE(zoomArea), 0, sizeof(RECT));
+            UpdateMandelbrot();
+            memset(&GLOBAL_VARIABLE(zoomArea), 0, sizeof(PixelRectangle));
             glutPostRedisplay();
         }
 
@@ -187,6 +378,27 @@ void GLUTCALLBACK MouseCallback(GLint button, GLint state, GLint x, GLint y)
         break;
 
     case GLUT_RIGHT_BUTTON:
+        if (state == GLUT_DOWN)
+        {
+            GLOBAL_VARIABLE(panOrigin).x = x;
+            GLOBAL_VARIABLE(panOrigin).y = y;
+        }
+        else if (state == GLUT_UP && (x != GLOBAL_VARIABLE(panOrigin).x || y != GLOBAL_VARIABLE(panOrigin).y))
+        {
+            // Panning by whole pixels keeps the new grid on top of the old one, so the overlap comes from the cache.
+            centerOffset.realNumber      = -(x - GLOBAL_VARIABLE(panOrigin).x) * std::get<0>(GLOBAL_VARIABLE(mandelbrotViewport)) / (WINDOW_SIZE.cx - 1);
+            centerOffset.imaginaryNumber =  (y - GLOBAL_VARIABLE(panOrigin).y) * std::get<1>(GLOBAL_VARIABLE(mandelbrotViewport)) / (WINDOW_SIZE.cy - 1);
+
+            std::get<0>(GLOBAL_VARIABLE(mandelbrotCenter)) = std::get<0>(GLOBAL_VARIABLE(mandelbrotCenter)) + centerOffset.realNumber;
+            std::get<1>(GLOBAL_VARIABLE(mandelbrotCenter)) = std::get<1>(GLOBAL_VARIABLE(mandelbrotCenter)) + centerOffset.imaginaryNumber;
+
+            std::get<0>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) = std::get<0>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) + PreciseNumber(centerOffset.realNumber);
+            std::get<1>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) = std::get<1>(GLOBAL_VARIABLE(mandelbrotPreciseCenter)) + PreciseNumber(centerOffset.imaginaryNumber);
+
+            UpdateMandelbrot();
+            glutPostRedisplay();
+        }
+
         GLOBAL_VARIABLE(mouseButton) = MOUSEBUTTON::RIGHT_BUTTON;
         break;
     }
@@ -205,9 +417,21 @@ void GLUTCALLBACK MotionCallback(GLint x, GLint y)
 
 int main(int argc, char* argv[])
 {
+    if (argc > 1 && strcmp(argv[1], "--benchmark") == 0)
+    {
+        BenchmarkMandelbrot();
+        return 0;
+    }
+
+    GLOBAL_VARIABLE(mandelbrotOption) = GetDefaultMandelbrotOption();
+
+    for (int index = 1; index < argc; ++index)
+        if (strcmp(argv[index], "--mariani-silver") == 0)
+            GLOBAL_VARIABLE(mandelbrotOption).solver = MANDELBROTSOLVER::MARIANI_SILVER;
+
     glutInit(&argc, argv);
     glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE);
-    glutInitWindowPosition(WINDOW_COORD.X, WINDOW_COORD.Y);
+    glutInitWindowPosition(WINDOW_COORD.x, WINDOW_COORD.y);
     glutInitWindowSize(WINDOW_SIZE.cx, WINDOW_SIZE.cy);
     glutCreateWindow("Mandelbrot");
 
@@ -220,7 +444,8 @@ int main(int argc, char* argv[])
     glutMotionFunc(MotionCallback);
 
     glutMainLoop();
-    SAFE_DELETE(GLOBAL_VARIABLE(image));
+    delete GLOBAL_VARIABLE(presenter);
+    SAFE_DELETE(GLOBAL_VARIABLE(iterationImage));
 
     return 0;
 }
\ No newline at end of file
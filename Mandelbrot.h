@@ -0,0 +1,1199 @@
+#pragma once
+
+#include "Raster.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define SIMD_X86
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+#ifndef TARGET_ATTRIBUTE
+    #if defined(_MSC_VER)
+        #define TARGET_ATTRIBUTE(instruction)
+    #else
+        #define TARGET_ATTRIBUTE(instruction) __attribute__((target(instruction), optimize("fp-contract=off")))
+    #endif
+#endif
+
+typedef void (*MandelbrotKernel)(const double* realNumbers, const double* imaginaryNumbers, int* iterations, int count, int maxIteration);
+
+enum class SIMDINSTRUCTION
+{
+    SCALAR = 0,
+    SSE2   = 1,
+    AVX2   = 2,
+    AVX512 = 3
+};
+
+enum class MANDELBROTSOLVER
+{
+    BRUTE_FORCE    = 0,
+    MARIANI_SILVER = 1
+};
+
+struct ComplexNumber
+{
+    double realNumber;
+    double imaginaryNumber;
+};
+
+struct MandelbrotOption
+{
+    int              threadCount;
+    SIMDINSTRUCTION  simdInstruction;
+    MANDELBROTSOLVER solver;
+};
+
+struct MandelbrotStatistics
+{
+    long long iteratedPixelCount;
+    long long cachedPixelCount;
+};
+
+struct ReferenceOrbit
+{
+    std::vector<ComplexNumber> points;
+    ComplexNumber              seriesCoefficients[3];
+    int                        seriesIteration;
+};
+
+struct IterationFrame
+{
+    PixelSize                  imageSize;
+    std::tuple<double, double> center;
+    std::tuple<double, double> viewport;
+    int                        maxIteration;
+    int                        sampleStep;
+    std::vector<int>           iterations;
+};
+
+template <int LIMB_COUNT>
+class FixedPointNumber
+{
+public:
+    FixedPointNumber() : limbs()
+    {
+    }
+
+    explicit FixedPointNumber(double value) : limbs()
+    {
+        double magnitude = fabs(value);
+
+        for (int index = LIMB_COUNT - 1; index >= 0 && magnitude > 0.0; --index)
+        {
+            limbs[index] = (uint32_t)magnitude;
+            magnitude    = (magnitude - limbs[index]) * 4294967296.0;
+        }
+
+        if (value < 0.0)
+            Negate();
+    }
+
+    double ToDouble() const
+    {
+        FixedPointNumber magnitude = (IsNegative() == true) ? (-*this) : (*this);
+        double           value     = 0.0;
+
+        for (int index = 0; index < LIMB_COUNT; ++index)
+            value += ldexp((double)magnitude.limbs[index], 32 * (index - (LIMB_COUNT - 1)));
+
+        return (IsNegative() == true) ? (-value) : (value);
+    }
+
+    bool IsNegative() const
+    {
+        return (limbs[LIMB_COUNT - 1] & 0x80000000U) != 0;
+    }
+
+    FixedPointNumber operator-() const
+    {
+        FixedPointNumber result = *this;
+
+        result.Negate();
+
+        return result;
+    }
+
+    FixedPointNumber operator+(const FixedPointNumber& other) const
+    {
+        FixedPointNumber result;
+        uint64_t         carry = 0;
+
+        for (int index = 0; index < LIMB_COUNT; ++index)
+        {
+            carry               = carry + limbs[index] + other.limbs[index];
+            result.limbs[index] = (uint32_t)carry;
+            carry               = carry >> 32;
+        }
+
+        return result;
+    }
+
+    FixedPointNumber operator-(const FixedPointNumber& other) const
+    {
+        return *this + (-other);
+    }
+
+    FixedPointNumber operator*(const FixedPointNumber& other) const
+    {
+        FixedPointNumber leftMagnitude  = (IsNegative() == true)       ? (-*this)  : (*this);
+        FixedPointNumber rightMagnitude = (other.IsNegative() == true) ? (-other) : (other);
+        FixedPointNumber result;
+        uint32_t         product[LIMB_COUNT * 2] = {};
+        uint64_t         carry;
+
+        for (int leftIndex = 0; leftIndex < LIMB_COUNT; ++leftIndex)
+        {
+            carry = 0;
+
+            for (int rightIndex = 0; rightIndex < LIMB_COUNT; ++rightIndex)
+            {
+                carry                           = carry + (uint64_t)leftMagnitude.limbs[leftIndex] * rightMagnitude.limbs[rightIndex] + product[leftIndex + rightIndex];
+                product[leftIndex + rightIndex] = (uint32_t)carry;
+                carry                           = carry >> 32;
+            }
+
+            product[leftIndex + LIMB_COUNT] = (uint32_t)carry;
+        }
+
+        for (int index = 0; index < LIMB_COUNT; ++index)
+            result.limbs[index] = product[index + LIMB_COUNT - 1];
+
+        return (IsNegative() != other.IsNegative()) ? (-result) : (result);
+    }
+
+private:
+    uint32_t limbs[LIMB_COUNT];
+
+    void Negate()
+    {
+        uint64_t carry = 1;
+
+        for (int index = 0; index < LIMB_COUNT; ++index)
+        {
+            carry        = carry + (uint32_t)~limbs[index];
+            limbs[index] = (uint32_t)carry;
+            carry        = carry >> 32;
+        }
+    }
+};
+
+static const int    MAX_ITERATION        = 100;
+static const int    TILE_SIZE            = 32;
+static const int    MIN_RECTANGLE_SIZE   = 16;
+static const int    PRECISION_LIMB_COUNT = 12;
+static const double DEEP_ZOOM_THRESHOLD  = 1e-10;
+static const double SERIES_TOLERANCE     = 1e-12;
+static const int    PREVIEW_STEP         = 8;
+static const int    CACHE_FRAME_COUNT    = 4;
+static const double CACHE_TOLERANCE      = 1.0 / 1024.0;
+
+static const char* const SIMD_INSTRUCTION_NAMES[4]  = { "Scalar", "SSE2", "AVX2", "AVX-512" };
+static const char* const MANDELBROT_SOLVER_NAMES[2] = { "Brute Force", "Mariani-Silver" };
+
+typedef FixedPointNumber<PRECISION_LIMB_COUNT> PreciseNumber;
+
+inline ComplexNumber operator+(ComplexNumber complexNumber1, ComplexNumber complexNumber2)
+{
+    return { complexNumber1.realNumber + complexNumber2.realNumber, complexNumber1.imaginaryNumber + complexNumber2.imaginaryNumber };
+}
+
+inline ComplexNumber operator*(ComplexNumber complexNumber1, ComplexNumber complexNumber2)
+{
+    return { complexNumber1.realNumber * complexNumber2.realNumber - complexNumber1.imaginaryNumber * complexNumber2.imaginaryNumber, complexNumber1.realNumber * complexNumber2.imaginaryNumber + complexNumber1.imaginaryNumber * complexNumber2.realNumber };
+}
+
+inline ComplexNumber operator*(double scalar, ComplexNumber complexNumber)
+{
+    return { scalar * complexNumber.realNumber, scalar * complexNumber.imaginaryNumber };
+}
+
+inline double SquaredMagnitude(ComplexNumber complexNumber)
+{
+    return complexNumber.realNumber * complexNumber.realNumber + complexNumber.imaginaryNumber * complexNumber.imaginaryNumber;
+}
+
+class IterationCache
+{
+public:
+    int GetFrameCount() const
+    {
+        return (int)frames.size();
+    }
+
+    // Maps a coordinate onto a sample column of the frameIndex-th most recent frame, or -1 if none sits on it.
+    int FindColumn(int frameIndex, double realNumber, double tolerance) const
+    {
+        const IterationFrame& frame = frames[frames.size() - 1 - frameIndex];
+
+        return FindSample(realNumber, std::get<0>(frame.center), std::get<0>(frame.viewport), frame.imageSize.cx, frame.sampleStep, tolerance);
+    }
+
+    int FindRow(int frameIndex, double imaginaryNumber, double tolerance) const
+    {
+        const IterationFrame& frame = frames[frames.size() - 1 - frameIndex];
+
+        return FindSample(imaginaryNumber, std::get<1>(frame.center), std::get<1>(frame.viewport), frame.imageSize.cy, frame.sampleStep, tolerance);
+    }
+
+    bool Lookup(int frameIndex, int column, int row, int maxIteration, int& iteration) const
+    {
+        const IterationFrame& frame = frames[frames.size() - 1 - frameIndex];
+        int                   value = frame.iterations[row * frame.imageSize.cx + column];
+
+        // An escaped sample is exact under any cap, a bounded one only under a cap that is not higher.
+        if (value < frame.maxIteration)
+        {
+            iteration = std::min(value, maxIteration);
+            return true;
+        }
+
+        if (maxIteration <= frame.maxIteration)
+        {
+            iteration = maxIteration;
+            return true;
+        }
+
+        return false;
+    }
+
+    void Store(PixelSize imageSize, std::tuple<double, double> center, std::tuple<double, double> viewport, int maxIteration, int sampleStep, const int* iterationImage)
+    {
+        std::deque<IterationFrame>::iterator frame = std::find_if(frames.begin(), frames.end(), [&](const IterationFrame& cachedFrame)
+        {
+            return cachedFrame.imageSize.cx == imageSize.cx && cachedFrame.imageSize.cy == imageSize.cy && cachedFrame.center == center && cachedFrame.viewport == viewport;
+        });
+
+        // A coarser level of a view never replaces a finer one already cached.
+        if (frame != frames.end())
+        {
+            IterationFrame storedFrame = std::move(*frame);
+
+            frames.erase(frame);
+
+            if (storedFrame.sampleStep <= sampleStep)
+            {
+                frames.push_back(std::move(storedFrame));
+                return;
+            }
+        }
+
+        frames.push_back({ imageSize, center, viewport, maxIteration, sampleStep, std::vector<int>(iterationImage, iterationImage + (size_t)imageSize.cx * imageSize.cy) });
+
+        if ((int)frames.size() > CACHE_FRAME_COUNT)
+            frames.pop_front();
+    }
+
+    void Clear()
+    {
+        frames.clear();
+    }
+
+private:
+    std::deque<IterationFrame> frames;
+
+    // Only samples sitting on the requested coordinate are reused, so cached and freshly iterated pixels agree.
+    static int FindSample(double coordinate, double center, double viewport, coord_t length, int sampleStep, double tolerance)
+    {
+        double position = (coordinate - center + viewport / 2.0) * (length - 1) / viewport;
+
+        if (position < -0.5 || position > length - 0.5)
+            return -1;
+
+        int index = std::min((int)floor(position + 0.5), (int)length - 1);
+
+        if (index % sampleStep != 0 || fabs(index * viewport / (length - 1) - viewport / 2.0 + center - coordinate) > tolerance)
+            return -1;
+
+        return index;
+    }
+};
+
+class ImagePresenter
+{
+public:
+    virtual ~ImagePresenter()
+    {
+    }
+
+    // Upload hands a finished frame over once; Present redraws it with the zoom rectangle on top as often as needed.
+    virtual void Upload(const Framebuffer<Gray8>& image) = 0;
+    virtual void Present(PixelRectangle zoomArea) = 0;
+};
+
+// Stands in for the window when there is no GL context: it keeps the uploaded frame and composites on request.
+class MemoryPresenter : public ImagePresenter
+{
+public:
+    explicit MemoryPresenter(PixelSize imageSize) : imageSize(imageSize), image(imageSize.cx, imageSize.cy), zoomArea(), uploadCount(0), presentCount(0)
+    {
+    }
+
+    void Upload(const Framebuffer<Gray8>& image) override
+    {
+        this->image  = image;
+        uploadCount += 1;
+    }
+
+    void Present(PixelRectangle zoomArea) override
+    {
+        this->zoomArea  = zoomArea;
+        presentCount   += 1;
+    }
+
+    // Writes what the window would show into an RGB framebuffer, with the bottom row first like the uploaded image.
+    Framebuffer<RGB8>& Snapshot(Framebuffer<RGB8>& framebuffer) const
+    {
+        framebuffer.Resize(imageSize.cx, imageSize.cy);
+
+        for (coord_t y = 0; y < imageSize.cy; ++y)
+            for (coord_t x = 0; x < imageSize.cx; ++x)
+                RGB8::Store(framebuffer.GetPixel(x, y), RGB8::CreateGray(image.GetData()[y * image.GetStride() + x]));
+
+        for (coord_t x = std::min(zoomArea.left, zoomArea.right); x <= std::max(zoomArea.left, zoomArea.right); ++x)
+        {
+            SetPixel(framebuffer, { x, imageSize.cy - zoomArea.top },    { 255, 0, 0 });
+            SetPixel(framebuffer, { x, imageSize.cy - zoomArea.bottom }, { 255, 0, 0 });
+        }
+
+        for (coord_t y = std::min(zoomArea.top, zoomArea.bottom); y <= std::max(zoomArea.top, zoomArea.bottom); ++y)
+        {
+            SetPixel(framebuffer, { zoomArea.left,  imageSize.cy - y }, { 255, 0, 0 });
+            SetPixel(framebuffer, { zoomArea.right, imageSize.cy - y }, { 255, 0, 0 });
+        }
+
+        return framebuffer;
+    }
+
+    int GetUploadCount() const
+    {
+        return uploadCount;
+    }
+
+    int GetPresentCount() const
+    {
+        return presentCount;
+    }
+
+private:
+    PixelSize          imageSize;
+    Framebuffer<Gray8> image;
+    PixelRectangle     zoomArea;
+    int                uploadCount;
+    int                presentCount;
+};
+
+class WorkStealingScheduler
+{
+public:
+    explicit WorkStealingScheduler(int threadCount) : queues(threadCount), mutexes(threadCount)
+    {
+    }
+
+    template <typename FUNCTION>
+    void Run(const std::vector<PixelRectangle>& tiles, FUNCTION function)
+    {
+        std::vector<std::thread> threads;
+
+        for (int index = 0; index < (int)tiles.size(); ++index)
+            queues[index % queues.size()].push_back(index);
+
+        for (int threadIndex = 1; threadIndex < (int)queues.size(); ++threadIndex)
+            threads.emplace_back([&, threadIndex]() { Work(threadIndex, tiles, function); });
+
+        Work(0, tiles, function);
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+private:
+    std::vector<std::deque<int>> queues;
+    std::vector<std::mutex>      mutexes;
+
+    bool PopTile(int threadIndex, int& tileIndex)
+    {
+        std::lock_guard<std::mutex> lock(mutexes[threadIndex]);
+
+        if (queues[threadIndex].empty() == true)
+            return false;
+
+        tileIndex = queues[threadIndex].back();
+        queues[threadIndex].pop_back();
+
+        return true;
+    }
+
+    bool StealTile(int threadIndex, int& tileIndex)
+    {
+        for (int offset = 1; offset < (int)queues.size(); ++offset)
+        {
+            int                         victimIndex = (threadIndex + offset) % (int)queues.size();
+            std::lock_guard<std::mutex> lock(mutexes[victimIndex]);
+
+            if (queues[victimIndex].empty() == true)
+                continue;
+
+            tileIndex = queues[victimIndex].front();
+            queues[victimIndex].pop_front();
+
+            return true;
+        }
+
+        return false;
+    }
+
+    template <typename FUNCTION>
+    void Work(int threadIndex, const std::vector<PixelRectangle>& tiles, FUNCTION& function)
+    {
+        int tileIndex;
+
+        while (PopTile(threadIndex, tileIndex) == true || StealTile(threadIndex, tileIndex) == true)
+            function(tiles[tileIndex]);
+    }
+};
+
+inline int GetThreadCount()
+{
+    return std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+inline int GetCorrectedMaxIteration(std::tuple<double, double> viewport)
+{
+    return MAX_ITERATION + 10 * (int)((1.0 - log10(std::get<0>(viewport))) / log10(2.0));
+}
+
+inline std::vector<PixelRectangle> CreateTiles(PixelSize imageSize, int tileSize)
+{
+    std::vector<PixelRectangle> tiles;
+
+    for (coord_t top = 0; top < imageSize.cy; top += tileSize)
+        for (coord_t left = 0; left < imageSize.cx; left += tileSize)
+            tiles.push_back({ left, top, std::min(left + tileSize, imageSize.cx), std::min(top + tileSize, imageSize.cy) });
+
+    return tiles;
+}
+
+inline int IterateMandelbrot(ComplexNumber complexNumber, int maxIteration)
+{
+    double realNumber             = 0.0;
+    double imaginaryNumber        = 0.0;
+    double squaredRealNumber      = 0.0;
+    double squaredImaginaryNumber = 0.0;
+    int    iteration;
+
+    for (iteration = 0; iteration < maxIteration; ++iteration)
+    {
+        imaginaryNumber        = 2.0 * realNumber * imaginaryNumber + complexNumber.imaginaryNumber;
+        realNumber             = squaredRealNumber - squaredImaginaryNumber + complexNumber.realNumber;
+        squaredRealNumber      = realNumber * realNumber;
+        squaredImaginaryNumber = imaginaryNumber * imaginaryNumber;
+
+        if (squaredRealNumber + squaredImaginaryNumber > 4.0)
+            break;
+    }
+
+    return iteration;
+}
+
+inline void IterateMandelbrotScalar(const double* realNumbers, const double* imaginaryNumbers, int* iterations, int count, int maxIteration)
+{
+    for (int index = 0; index < count; ++index)
+        iterations[index] = IterateMandelbrot({ realNumbers[index], imaginaryNumbers[index] }, maxIteration);
+}
+
+#ifdef SIMD_X86
+TARGET_ATTRIBUTE("sse2")
+inline void IterateMandelbrotSSE2(const double* realNumbers, const double* imaginaryNumbers, int* iterations, int count, int maxIteration)
+{
+    const __m128d zero         = _mm_setzero_pd();
+    const __m128d one          = _mm_set1_pd(1.0);
+    const __m128d two          = _mm_set1_pd(2.0);
+    const __m128d escapeRadius = _mm_set1_pd(4.0);
+    __m128d       constantReal;
+    __m128d       constantImaginary;
+    __m128d       real, imaginary;
+    __m128d       squaredReal, squaredImaginary;
+    __m128d       activeMask;
+    __m128d       counter;
+    int           index;
+
+    for (index = 0; index + 2 <= count; index += 2)
+    {
+        constantReal      = _mm_loadu_pd(realNumbers + index);
+        constantImaginary = _mm_loadu_pd(imaginaryNumbers + index);
+        real              = zero;
+        imaginary         = zero;
+        squaredReal       = zero;
+        squaredImaginary  = zero;
+        activeMask        = _mm_cmpeq_pd(zero, zero);
+        counter           = zero;
+
+        for (int iteration = 0; iteration < maxIteration; ++iteration)
+        {
+            imaginary        = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(two, real), imaginary), constantImaginary);
+            real             = _mm_add_pd(_mm_sub_pd(squaredReal, squaredImaginary), constantReal);
+            squaredReal      = _mm_mul_pd(real, real);
+            squaredImaginary = _mm_mul_pd(imaginary, imaginary);
+            activeMask       = _mm_andnot_pd(_mm_cmpgt_pd(_mm_add_pd(squaredReal, squaredImaginary), escapeRadius), activeMask);
+
+            if (_mm_movemask_pd(activeMask) == 0)
+                break;
+
+            counter = _mm_add_pd(counter, _mm_and_pd(activeMask, one));
+        }
+
+        _mm_storel_epi64((__m128i*)(iterations + index), _mm_cvtpd_epi32(counter));
+    }
+
+    IterateMandelbrotScalar(realNumbers + index, imaginaryNumbers + index, iterations + index, count - index, maxIteration);
+}
+
+TARGET_ATTRIBUTE("avx2")
+inline void IterateMandelbrotAVX2(const double* realNumbers, const double* imaginaryNumbers, int* iterations, int count, int maxIteration)
+{
+    const __m256d zero         = _mm256_setzero_pd();
+    const __m256d one          = _mm256_set1_pd(1.0);
+    const __m256d two          = _mm256_set1_pd(2.0);
+    const __m256d escapeRadius = _mm256_set1_pd(4.0);
+    __m256d       constantReal;
+    __m256d       constantImaginary;
+    __m256d       real, imaginary;
+    __m256d       squaredReal, squaredImaginary;
+    __m256d       activeMask;
+    __m256d       counter;
+    int           index;
+
+    for (index = 0; index + 4 <= count; index += 4)
+    {
+        constantReal      = _mm256_loadu_pd(realNumbers + index);
+        constantImaginary = _mm256_loadu_pd(imaginaryNumbers + index);
+        real              = zero;
+        imaginary         = zero;
+        squaredReal       = zero;
+        squaredImaginary  = zero;
+        activeMask        = _mm256_cmp_pd(zero, zero, _CMP_EQ_OQ);
+        counter           = zero;
+
+        for (int iteration = 0; iteration < maxIteration; ++iteration)
+        {
+            imaginary        = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(two, real), imaginary), constantImaginary);
+            real             = _mm256_add_pd(_mm256_sub_pd(squaredReal, squaredImaginary), constantReal);
+            squaredReal      = _mm256_mul_pd(real, real);
+            squaredImaginary = _mm256_mul_pd(imaginary, imaginary);
+            activeMask       = _mm256_andnot_pd(_mm256_cmp_pd(_mm256_add_pd(squaredReal, squaredImaginary), escapeRadius, _CMP_GT_OQ), activeMask);
+
+            if (_mm256_movemask_pd(activeMask) == 0)
+                break;
+
+            counter = _mm256_add_pd(counter, _mm256_and_pd(activeMask, one));
+        }
+
+        _mm_storeu_si128((__m128i*)(iterations + index), _mm256_cvtpd_epi32(counter));
+    }
+
+    IterateMandelbrotScalar(realNumbers + index, imaginaryNumbers + index, iterations + index, count - index, maxIteration);
+}
+
+TARGET_ATTRIBUTE("avx512f")
+inline void IterateMandelbrotAVX512(const double* realNumbers, const double* imaginaryNumbers, int* iterations, int count, int maxIteration)
+{
+    const __m512d zero         = _mm512_setzero_pd();
+    const __m512d two          = _mm512_set1_pd(2.0);
+    const __m512d escapeRadius = _mm512_set1_pd(4.0);
+    const __m512i one          = _mm512_set1_epi32(1);
+    __m512d       constantReal;
+    __m512d       constantImaginary;
+    __m512d       real, imaginary;
+    __m512d       squaredReal, squaredImaginary;
+    __mmask8      activeMask;
+    __m512i       counter;
+    int           index;
+
+    for (index = 0; index + 8 <= count; index += 8)
+    {
+        constantReal      = _mm512_loadu_pd(realNumbers + index);
+        constantImaginary = _mm512_loadu_pd(imaginaryNumbers + index);
+        real              = zero;
+        imaginary         = zero;
+        squaredReal       = zero;
+        squaredImaginary  = zero;
+        activeMask        = 0xFF;
+        counter           = _mm512_setzero_si512();
+
+        for (int iteration = 0; iteration < maxIteration; ++iteration)
+        {
+            imaginary        = _mm512_add_pd(_mm512_mul_pd(_mm512_mul_pd(two, real), imaginary), constantImaginary);
+            real             = _mm512_add_pd(_mm512_sub_pd(squaredReal, squaredImaginary), constantReal);
+            squaredReal      = _mm512_mul_pd(real, real);
+            squaredImaginary = _mm512_mul_pd(imaginary, imaginary);
+            activeMask       = activeMask & ~_mm512_cmp_pd_mask(_mm512_add_pd(squaredReal, squaredImaginary), escapeRadius, _CMP_GT_OQ);
+
+            if (activeMask == 0)
+                break;
+
+            counter = _mm512_mask_add_epi32(counter, (__mmask16)activeMask, counter, one);
+        }
+
+        // The counts are kept in the low eight 32-bit lanes and stored under a mask, with no conversion from double.
+        _mm512_mask_storeu_epi32(iterations + index, (__mmask16)0x00FF, counter);
+    }
+
+    IterateMandelbrotScalar(realNumbers + index, imaginaryNumbers + index, iterations + index, count - index, maxIteration);
+}
+#endif
+
+inline SIMDINSTRUCTION DetectSIMDInstruction()
+{
+#if defined(SIMD_X86) && defined(_MSC_VER)
+    int                cpuInfo[4];
+    bool               osSupportsAVX;
+    bool               osSupportsAVX512;
+    unsigned long long extendedControl = 0;
+
+    __cpuid(cpuInfo, 1);
+
+    if ((cpuInfo[2] & (1 << 27)) != 0)
+        extendedControl = _xgetbv(0);
+
+    osSupportsAVX    = (cpuInfo[2] & (1 << 28)) != 0 && (extendedControl & 0x06) == 0x06;
+    osSupportsAVX512 = osSupportsAVX == true && (extendedControl & 0xE0) == 0xE0;
+
+    if ((cpuInfo[3] & (1 << 26)) == 0)
+        return SIMDINSTRUCTION::SCALAR;
+
+    __cpuidex(cpuInfo, 7, 0);
+
+    if (osSupportsAVX512 == true && (cpuInfo[1] & (1 << 16)) != 0)
+        return SIMDINSTRUCTION::AVX512;
+
+    if (osSupportsAVX == true && (cpuInfo[1] & (1 << 5)) != 0)
+        return SIMDINSTRUCTION::AVX2;
+
+    return SIMDINSTRUCTION::SSE2;
+#elif defined(SIMD_X86)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        return SIMDINSTRUCTION::AVX512;
+
+    if (__builtin_cpu_supports("avx2"))
+        return SIMDINSTRUCTION::AVX2;
+
+    if (__builtin_cpu_supports("sse2"))
+        return SIMDINSTRUCTION::SSE2;
+
+    return SIMDINSTRUCTION::SCALAR;
+#else
+    return SIMDINSTRUCTION::SCALAR;
+#endif
+}
+
+inline MandelbrotKernel GetMandelbrotKernel(SIMDINSTRUCTION simdInstruction)
+{
+    switch (simdInstruction)
+    {
+#ifdef SIMD_X86
+    case SIMDINSTRUCTION::SSE2:
+        return IterateMandelbrotSSE2;
+
+    case SIMDINSTRUCTION::AVX2:
+        return IterateMandelbrotAVX2;
+
+    case SIMDINSTRUCTION::AVX512:
+        return IterateMandelbrotAVX512;
+#endif
+
+    default:
+        return IterateMandelbrotScalar;
+    }
+}
+
+inline MandelbrotOption GetDefaultMandelbrotOption()
+{
+    static const MandelbrotOption defaultOption = { GetThreadCount(), DetectSIMDInstruction(), MANDELBROTSOLVER::BRUTE_FORCE };
+
+    return defaultOption;
+}
+
+inline long long ComputeMandelbrotTile(int* iterationImage, PixelSize imageSize, PixelRectangle tile, std::tuple<double, double> center, std::tuple<double, double> viewport, int maxIteration, MandelbrotKernel kernel)
+{
+    double realNumbers[TILE_SIZE];
+    double imaginaryNumbers[TILE_SIZE];
+
+    for (int ix = tile.left; ix < tile.right; ++ix)
+        realNumbers[ix - tile.left] = ix * std::get<0>(viewport) / (imageSize.cx - 1) - std::get<0>(viewport) / 2.0 + std::get<0>(center);
+
+    for (int iy = tile.top; iy < tile.bottom; ++iy)
+    {
+        std::fill(imaginaryNumbers, imaginaryNumbers + tile.right - tile.left, iy * std::get<1>(viewport) / (imageSize.cy - 1) - std::get<1>(viewport) / 2.0 + std::get<1>(center));
+
+        kernel(realNumbers, imaginaryNumbers, iterationImage + iy * imageSize.cx + tile.left, tile.right - tile.left, maxIteration);
+    }
+
+    return (long long)(tile.right - tile.left) * (tile.bottom - tile.top);
+}
+
+// Mariani-Silver is approximate: escape channels thinner than a pixel can slip between border samples. Brute force is exact.
+class MandelbrotTileSolver
+{
+public:
+    MandelbrotTileSolver(int* iterationImage, PixelSize imageSize, PixelRectangle tile, std::tuple<double, double> center, std::tuple<double, double> viewport, int maxIteration, MandelbrotKernel kernel)
+        : iterationImage(iterationImage), imageSize(imageSize), tile(tile), maxIteration(maxIteration), kernel(kernel), iteratedPixelCount(0), queuedCount(0)
+    {
+        for (int ix = tile.left; ix < tile.right; ++ix)
+            realNumbers[ix - tile.left] = ix * std::get<0>(viewport) / (imageSize.cx - 1) - std::get<0>(viewport) / 2.0 + std::get<0>(center);
+
+        for (int iy = tile.top; iy < tile.bottom; ++iy)
+            imaginaryNumbers[iy - tile.top] = iy * std::get<1>(viewport) / (imageSize.cy - 1) - std::get<1>(viewport) / 2.0 + std::get<1>(center);
+    }
+
+    // Tiles start on multiples of TILE_SIZE, so tile-relative sample positions are also image-relative ones.
+    long long MarkPixels(int sampleStep, const IterationCache* cache, double tolerance)
+    {
+        long long cachedPixelCount = 0;
+        int       frameCount       = (cache != nullptr) ? (std::min(cache->GetFrameCount(), CACHE_FRAME_COUNT)) : (0);
+        int       columns[CACHE_FRAME_COUNT][TILE_SIZE];
+        int       rows[CACHE_FRAME_COUNT][TILE_SIZE];
+
+        // The grid is separable, so every cached frame is matched once per column and once per row instead of per pixel.
+        for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+        {
+            for (int ix = tile.left; ix < tile.right; ix += sampleStep)
+                columns[frameIndex][ix - tile.left] = cache->FindColumn(frameIndex, realNumbers[ix - tile.left], tolerance);
+
+            for (int iy = tile.top; iy < tile.bottom; iy += sampleStep)
+                rows[frameIndex][iy - tile.top] = cache->FindRow(frameIndex, imaginaryNumbers[iy - tile.top], tolerance);
+        }
+
+        for (int iy = tile.top; iy < tile.bottom; iy += sampleStep)
+            for (int ix = tile.left; ix < tile.right; ix += sampleStep)
+            {
+                int& pixel = iterationImage[iy * imageSize.cx + ix];
+
+                pixel = -1;
+
+                for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+                {
+                    int column = columns[frameIndex][ix - tile.left];
+                    int row    = rows[frameIndex][iy - tile.top];
+
+                    if (column != -1 && row != -1 && cache->Lookup(frameIndex, column, row, maxIteration, pixel) == true)
+                    {
+                        cachedPixelCount += 1;
+                        break;
+                    }
+                }
+            }
+
+        return cachedPixelCount;
+    }
+
+    long long SolveRectangles()
+    {
+        SolveRectangle(tile);
+
+        return iteratedPixelCount;
+    }
+
+    long long SolveSamples(int sampleStep)
+    {
+        for (int iy = tile.top; iy < tile.bottom; iy += sampleStep)
+            for (int ix = tile.left; ix < tile.right; ix += sampleStep)
+                QueuePixel(ix, iy);
+
+        FlushQueue();
+
+        return iteratedPixelCount;
+    }
+
+    void FillBlocks(int sampleStep)
+    {
+        if (sampleStep == 1)
+            return;
+
+        for (int iy = tile.top; iy < tile.bottom; ++iy)
+        {
+            int*       row       = iterationImage + iy * imageSize.cx;
+            const int* sampleRow = iterationImage + (iy - (iy - tile.top) % sampleStep) * imageSize.cx;
+
+            for (int ix = tile.left; ix < tile.right; ix += sampleStep)
+                std::fill(row + ix, row + std::min(ix + sampleStep, (int)tile.right), sampleRow[ix]);
+        }
+    }
+
+private:
+    int*             iterationImage;
+    PixelSize        imageSize;
+    PixelRectangle   tile;
+    int              maxIteration;
+    MandelbrotKernel kernel;
+    long long        iteratedPixelCount;
+    double           realNumbers[TILE_SIZE];
+    double           imaginaryNumbers[TILE_SIZE];
+    double           queuedRealNumbers[TILE_SIZE * TILE_SIZE];
+    double           queuedImaginaryNumbers[TILE_SIZE * TILE_SIZE];
+    int              queuedIterations[TILE_SIZE * TILE_SIZE];
+    int*             queuedPixels[TILE_SIZE * TILE_SIZE];
+    int              queuedCount;
+
+    void QueuePixel(int ix, int iy)
+    {
+        int* pixel = iterationImage + iy * imageSize.cx + ix;
+
+        if (*pixel != -1)
+            return;
+
+        queuedRealNumbers[queuedCount]      = realNumbers[ix - tile.left];
+        queuedImaginaryNumbers[queuedCount] = imaginaryNumbers[iy - tile.top];
+        queuedPixels[queuedCount]           = pixel;
+        queuedCount                        += 1;
+    }
+
+    void FlushQueue()
+    {
+        kernel(queuedRealNumbers, queuedImaginaryNumbers, queuedIterations, queuedCount, maxIteration);
+
+        for (int index = 0; index < queuedCount; ++index)
+            *queuedPixels[index] = queuedIterations[index];
+
+        iteratedPixelCount += queuedCount;
+        queuedCount         = 0;
+    }
+
+    // Queued pixels stay unresolved until the flush, so a rectangle one pixel wide or tall queues its edge only once.
+    void ComputeBorder(PixelRectangle rectangle)
+    {
+        for (int ix = rectangle.left; ix < rectangle.right; ++ix)
+        {
+            QueuePixel(ix, rectangle.top);
+
+            if (rectangle.bottom - rectangle.top > 1)
+                QueuePixel(ix, rectangle.bottom - 1);
+        }
+
+        for (int iy = rectangle.top + 1; iy < rectangle.bottom - 1; ++iy)
+        {
+            QueuePixel(rectangle.left, iy);
+
+            if (rectangle.right - rectangle.left > 1)
+                QueuePixel(rectangle.right - 1, iy);
+        }
+
+        FlushQueue();
+    }
+
+    void ComputeInterior(PixelRectangle rectangle)
+    {
+        for (int iy = rectangle.top + 1; iy < rectangle.bottom - 1; ++iy)
+            for (int ix = rectangle.left + 1; ix < rectangle.right - 1; ++ix)
+                QueuePixel(ix, iy);
+
+        FlushQueue();
+    }
+
+    bool IsUniformBorder(PixelRectangle rectangle, int& value)
+    {
+        value = iterationImage[rectangle.top * imageSize.cx + rectangle.left];
+
+        for (int ix = rectangle.left; ix < rectangle.right; ++ix)
+            if (iterationImage[rectangle.top * imageSize.cx + ix] != value || iterationImage[(rectangle.bottom - 1) * imageSize.cx + ix] != value)
+                return false;
+
+        for (int iy = rectangle.top + 1; iy < rectangle.bottom - 1; ++iy)
+            if (iterationImage[iy * imageSize.cx + rectangle.left] != value || iterationImage[iy * imageSize.cx + rectangle.right - 1] != value)
+                return false;
+
+        return true;
+    }
+
+    void SolveRectangle(PixelRectangle rectangle)
+    {
+        int  value;
+        coord_t middleX = (rectangle.left + rectangle.right - 1) / 2;
+        coord_t middleY = (rectangle.top + rectangle.bottom - 1) / 2;
+
+        ComputeBorder(rectangle);
+
+        if (rectangle.right - rectangle.left <= MIN_RECTANGLE_SIZE || rectangle.bottom - rectangle.top <= MIN_RECTANGLE_SIZE)
+        {
+            ComputeInterior(rectangle);
+            return;
+        }
+
+        if (IsUniformBorder(rectangle, value) == true)
+        {
+            for (int iy = rectangle.top + 1; iy < rectangle.bottom - 1; ++iy)
+                std::fill(iterationImage + iy * imageSize.cx + rectangle.left + 1, iterationImage + iy * imageSize.cx + rectangle.right - 1, value);
+
+            return;
+        }
+
+        SolveRectangle({ rectangle.left, rectangle.top, middleX + 1,     middleY + 1      });
+        SolveRectangle({ middleX,        rectangle.top, rectangle.right, middleY + 1      });
+        SolveRectangle({ rectangle.left, middleY,       middleX + 1,     rectangle.bottom });
+        SolveRectangle({ middleX,        middleY,       rectangle.right, rectangle.bottom });
+    }
+};
+
+inline std::tuple<int, int> GetIterationRange(const int* iterationImage, size_t pixelCount)
+{
+    std::pair<const int*, const int*> iterationRange = std::minmax_element(iterationImage, iterationImage + pixelCount);
+
+    return std::make_tuple(*iterationRange.first, *iterationRange.second);
+}
+
+// Fills the framebuffer from the rows of the iteration image it covers, scaled by the range of the whole image.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& NormalizeIterationImage(Framebuffer<FORMAT>& framebuffer, const int* iterationImage, std::tuple<int, int> iterationRange)
+{
+    double iterationMin = (double)std::get<0>(iterationRange);
+    double iterationMax = (double)std::get<1>(iterationRange);
+
+    // An image of one count, such as a view wholly inside the set, has no range; it comes out black like the maximum.
+    double range        = std::max(iterationMax - iterationMin, 1.0);
+
+    for (coord_t y = 0; y < framebuffer.GetHeight(); ++y)
+        for (coord_t x = 0; x < framebuffer.GetWidth(); ++x)
+            FORMAT::Store(framebuffer.GetPixel(x, y), FORMAT::CreateGray((byte_t)((iterationMax - iterationImage[y * framebuffer.GetWidth() + x]) * 255.0 / range + 0.5)));
+
+    return framebuffer;
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& NormalizeIterationImage(Framebuffer<FORMAT>& framebuffer, const int* iterationImage)
+{
+    return NormalizeIterationImage(framebuffer, iterationImage, GetIterationRange(iterationImage, (size_t)framebuffer.GetWidth() * framebuffer.GetHeight()));
+}
+
+// Streams the normalised image to disk a band of rows at a time instead of keeping a second full-size image.
+template <typename FORMAT>
+inline bool WriteIterationImage(const char* filePath, const int* iterationImage, PixelSize imageSize, bool isBinary = true)
+{
+    std::tuple<int, int> iterationRange = GetIterationRange(iterationImage, (size_t)imageSize.cx * imageSize.cy);
+    Framebuffer<FORMAT>  band;
+    PXMWriter<FORMAT>    writer;
+    coord_t              bandHeight;
+
+    EXECUTION_CONDITION(writer.Open(filePath, imageSize.cx, imageSize.cy, isBinary), false);
+
+    for (coord_t y = 0; y < imageSize.cy; y += bandHeight)
+    {
+        bandHeight = std::min(TILE_SIZE, imageSize.cy - y);
+        band.Resize(imageSize.cx, bandHeight);
+
+        NormalizeIterationImage(band, iterationImage + (size_t)y * imageSize.cx, iterationRange);
+        EXECUTION_CONDITION(writer.WriteRows(band, 0, bandHeight), false);
+    }
+
+    return writer.Close();
+}
+
+inline void ComputeMandelbrot(int* iterationImage, PixelSize imageSize, std::tuple<double, double> center, std::tuple<double, double> viewport, MandelbrotOption option, MandelbrotStatistics* statistics = nullptr)
+{
+    WorkStealingScheduler  scheduler(option.threadCount);
+    MandelbrotKernel       kernel                = GetMandelbrotKernel(option.simdInstruction);
+    int                    correctedMaxIteration = GetCorrectedMaxIteration(viewport);
+    std::atomic<long long> iteratedPixelCount(0);
+
+    scheduler.Run(CreateTiles(imageSize, TILE_SIZE), [&](const PixelRectangle& tile)
+    {
+        if (option.solver == MANDELBROTSOLVER::MARIANI_SILVER)
+        {
+            MandelbrotTileSolver solver(iterationImage, imageSize, tile, center, viewport, correctedMaxIteration, kernel);
+
+            solver.MarkPixels(1, nullptr, 0.0);
+            iteratedPixelCount += solver.SolveRectangles();
+        }
+        else
+            iteratedPixelCount += ComputeMandelbrotTile(iterationImage, imageSize, tile, center, viewport, correctedMaxIteration, kernel);
+    });
+
+    if (statistics != nullptr)
+    {
+        statistics->iteratedPixelCount = iteratedPixelCount;
+        statistics->cachedPixelCount   = 0;
+    }
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawMandelbrot(Framebuffer<FORMAT>& framebuffer, int* iterationImage, std::tuple<double, double> center, std::tuple<double, double> viewport, MandelbrotOption option, MandelbrotStatistics* statistics = nullptr)
+{
+    ComputeMandelbrot(iterationImage, framebuffer.GetSize(), center, viewport, option, statistics);
+
+    return NormalizeIterationImage(framebuffer, iterationImage);
+}
+
+// Resolves every sampleStep-th pixel, reusing the cache, and fills the rest of each block from its top-left sample.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawMandelbrotProgressive(Framebuffer<FORMAT>& framebuffer, int* iterationImage, std::tuple<double, double> center, std::tuple<double, double> viewport, MandelbrotOption option, int sampleStep, IterationCache& cache, MandelbrotStatistics* statistics = nullptr)
+{
+    WorkStealingScheduler  scheduler(option.threadCount);
+    PixelSize              imageSize             = framebuffer.GetSize();
+    MandelbrotKernel       kernel                = GetMandelbrotKernel(option.simdInstruction);
+    int                    correctedMaxIteration = GetCorrectedMaxIteration(viewport);
+    double                 tolerance             = CACHE_TOLERANCE * std::min(std::get<0>(viewport) / (imageSize.cx - 1), std::get<1>(viewport) / (imageSize.cy - 1));
+    std::atomic<long long> iteratedPixelCount(0);
+    std::atomic<long long> cachedPixelCount(0);
+
+    scheduler.Run(CreateTiles(imageSize, TILE_SIZE), [&](const PixelRectangle& tile)
+    {
+        MandelbrotTileSolver solver(iterationImage, imageSize, tile, center, viewport, correctedMaxIteration, kernel);
+
+        cachedPixelCount += solver.MarkPixels(sampleStep, &cache, tolerance);
+
+        if (sampleStep == 1 && option.solver == MANDELBROTSOLVER::MARIANI_SILVER)
+            iteratedPixelCount += solver.SolveRectangles();
+        else
+            iteratedPixelCount += solver.SolveSamples(sampleStep);
+
+        solver.FillBlocks(sampleStep);
+    });
+
+    cache.Store(imageSize, center, viewport, correctedMaxIteration, sampleStep, iterationImage);
+
+    if (statistics != nullptr)
+    {
+        statistics->iteratedPixelCount = iteratedPixelCount;
+        statistics->cachedPixelCount   = cachedPixelCount;
+    }
+
+    return NormalizeIterationImage(framebuffer, iterationImage);
+}
+
+inline ReferenceOrbit CreateReferenceOrbit(std::tuple<PreciseNumber, PreciseNumber> center, double maxDelta, int maxIteration)
+{
+    ReferenceOrbit referenceOrbit;
+    PreciseNumber  realNumber;
+    PreciseNumber  imaginaryNumber;
+    PreciseNumber  squaredRealNumber;
+    PreciseNumber  squaredImaginaryNumber;
+    ComplexNumber  point           = { 0.0, 0.0 };
+    ComplexNumber  coefficients[3] = {};
+    ComplexNumber  nextCoefficients[3];
+    double         boundedMagnitude;
+
+    referenceOrbit.points.push_back(point);
+
+    for (int iteration = 0; iteration < maxIteration && SquaredMagnitude(point) <= 4.0; ++iteration)
+    {
+        imaginaryNumber        = (realNumber + realNumber) * imaginaryNumber + std::get<1>(center);
+        realNumber             = squaredRealNumber - squaredImaginaryNumber + std::get<0>(center);
+        squaredRealNumber      = realNumber * realNumber;
+        squaredImaginaryNumber = imaginaryNumber * imaginaryNumber;
+        point                  = { realNumber.ToDouble(), imaginaryNumber.ToDouble() };
+
+        referenceOrbit.points.push_back(point);
+    }
+
+    referenceOrbit.seriesIteration = 0;
+
+    for (int iteration = 0; iteration + 2 < (int)referenceOrbit.points.size(); ++iteration)
+    {
+        nextCoefficients[0] = 2.0 * referenceOrbit.points[iteration] * coefficients[0] + ComplexNumber{ 1.0, 0.0 };
+        nextCoefficients[1] = 2.0 * referenceOrbit.points[iteration] * coefficients[1] + coefficients[0] * coefficients[0];
+        nextCoefficients[2] = 2.0 * referenceOrbit.points[iteration] * coefficients[2] + 2.0 * coefficients[0] * coefficients[1];
+
+        if (sqrt(SquaredMagnitude(nextCoefficients[2])) * maxDelta > SERIES_TOLERANCE * sqrt(SquaredMagnitude(nextCoefficients[1])))
+            break;
+
+        boundedMagnitude = sqrt(SquaredMagnitude(referenceOrbit.points[iteration + 1]));
+
+        for (int order = 0; order < 3; ++order)
+            boundedMagnitude += sqrt(SquaredMagnitude(nextCoefficients[order])) * pow(maxDelta, order + 1);
+
+        if (boundedMagnitude > 2.0)
+            break;
+
+        for (int order = 0; order < 3; ++order)
+            coefficients[order] = nextCoefficients[order];
+
+        referenceOrbit.seriesIteration = iteration + 1;
+    }
+
+    for (int order = 0; order < 3; ++order)
+        referenceOrbit.seriesCoefficients[order] = coefficients[order];
+
+    return referenceOrbit;
+}
+
+inline int IteratePerturbation(const ReferenceOrbit& referenceOrbit, ComplexNumber deltaConstant, int maxIteration)
+{
+    const ComplexNumber* points             = referenceOrbit.points.data();
+    int                  lastIndex          = (int)referenceOrbit.points.size() - 1;
+    int                  referenceIteration = referenceOrbit.seriesIteration;
+    int                  iteration          = referenceOrbit.seriesIteration;
+    ComplexNumber        delta;
+    ComplexNumber        point;
+
+    delta = ((referenceOrbit.seriesCoefficients[2] * deltaConstant + referenceOrbit.seriesCoefficients[1]) * deltaConstant + referenceOrbit.seriesCoefficients[0]) * deltaConstant;
+
+    while (iteration < maxIteration)
+    {
+        delta               = (2.0 * points[referenceIteration] + delta) * delta + deltaConstant;
+        referenceIteration += 1;
+        point               = points[referenceIteration] + delta;
+
+        if (SquaredMagnitude(point) > 4.0)
+            return iteration;
+
+        iteration += 1;
+
+        if (SquaredMagnitude(point) < SquaredMagnitude(delta) || referenceIteration == lastIndex)
+        {
+            delta              = point;
+            referenceIteration = 0;
+        }
+    }
+
+    return maxIteration;
+}
+
+inline void ComputePerturbationTile(int* iterationImage, PixelSize imageSize, PixelRectangle tile, const ReferenceOrbit& referenceOrbit, std::tuple<double, double> viewport, int maxIteration)
+{
+    ComplexNumber deltaConstant;
+
+    for (int iy = tile.top; iy < tile.bottom; ++iy)
+    {
+        deltaConstant.imaginaryNumber = (iy - (imageSize.cy - 1) / 2.0) * std::get<1>(viewport) / (imageSize.cy - 1);
+
+        for (int ix = tile.left; ix < tile.right; ++ix)
+        {
+            deltaConstant.realNumber = (ix - (imageSize.cx - 1) / 2.0) * std::get<0>(viewport) / (imageSize.cx - 1);
+
+            iterationImage[iy * imageSize.cx + ix] = IteratePerturbation(referenceOrbit, deltaConstant, maxIteration);
+        }
+    }
+}
+
+inline void ComputeMandelbrotDeep(int* iterationImage, PixelSize imageSize, std::tuple<PreciseNumber, PreciseNumber> center, std::tuple<double, double> viewport, MandelbrotOption option)
+{
+    WorkStealingScheduler scheduler(option.threadCount);
+    int                   correctedMaxIteration = GetCorrectedMaxIteration(viewport);
+    ReferenceOrbit        referenceOrbit        = CreateReferenceOrbit(center, hypot(std::get<0>(viewport), std::get<1>(viewport)) / 2.0, correctedMaxIteration);
+
+    scheduler.Run(CreateTiles(imageSize, TILE_SIZE), [&](const PixelRectangle& tile)
+    {
+        ComputePerturbationTile(iterationImage, imageSize, tile, referenceOrbit, viewport, correctedMaxIteration);
+    });
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawMandelbrotDeep(Framebuffer<FORMAT>& framebuffer, int* iterationImage, std::tuple<PreciseNumber, PreciseNumber> center, std::tuple<double, double> viewport, MandelbrotOption option)
+{
+    ComputeMandelbrotDeep(iterationImage, framebuffer.GetSize(), center, viewport, option);
+
+    return NormalizeIterationImage(framebuffer, iterationImage);
+}
\ No newline at end of file
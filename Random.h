@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <random>
+
+// xoshiro256** by Blackman and Vigna: a UniformRandomBitGenerator with 32 bytes of state against the 5 KB of std::mt19937.
+class RandomEngine
+{
+public:
+    typedef uint64_t result_type;
+
+    explicit RandomEngine(uint64_t seed = 0)
+    {
+        Seed(seed);
+    }
+
+    // Spreads the seed over the state with splitmix64, which can never leave it all zero.
+    void Seed(uint64_t seed)
+    {
+        for (uint64_t& value : state)
+        {
+            seed  += 0x9E3779B97F4A7C15ULL;
+            value  = seed;
+            value  = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value  = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            value ^= value >> 31;
+        }
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return UINT64_MAX;
+    }
+
+    result_type operator()()
+    {
+        uint64_t result = RotateLeft(state[1] * 5, 7) * 9;
+        uint64_t shift  = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shift;
+        state[3]  = RotateLeft(state[3], 45);
+
+        return result;
+    }
+
+    // Lemire's multiply-shift maps 32 random bits onto [minValue, maxValue], rejecting the few that would bias it.
+    int CreateInteger(int minValue, int maxValue)
+    {
+        uint32_t range = (uint32_t)maxValue - (uint32_t)minValue + 1;
+        uint64_t product;
+
+        if (range == 0)
+            return (int)((*this)() >> 32);
+
+        product = (uint64_t)(uint32_t)((*this)() >> 32) * range;
+
+        if ((uint32_t)product < range)
+        {
+            uint32_t threshold = (0U - range) % range;
+
+            while ((uint32_t)product < threshold)
+                product = (uint64_t)(uint32_t)((*this)() >> 32) * range;
+        }
+
+        return (int)((uint32_t)minValue + (uint32_t)(product >> 32));
+    }
+
+    // The top 53 bits give a double evenly spaced in [0, 1).
+    double CreateReal(double minValue, double maxValue)
+    {
+        return minValue + ((*this)() >> 11) * (1.0 / 9007199254740992.0) * (maxValue - minValue);
+    }
+
+    void CreateIntegers(int* values, size_t count, int minValue, int maxValue)
+    {
+        for (size_t index = 0; index < count; ++index)
+            values[index] = CreateInteger(minValue, maxValue);
+    }
+
+    template <typename TYPE>
+    void CreateReals(TYPE* values, size_t count, TYPE minValue, TYPE maxValue)
+    {
+        for (size_t index = 0; index < count; ++index)
+            values[index] = (TYPE)CreateReal(minValue, maxValue);
+    }
+
+    // Advances 2^128 numbers, so engines copied and jumped 0, 1, 2, ... times draw streams that never overlap.
+    void Jump()
+    {
+        static const uint64_t JUMP_POLYNOMIAL[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+        uint64_t              jumpedState[4]     = { 0, 0, 0, 0 };
+
+        for (uint64_t polynomial : JUMP_POLYNOMIAL)
+            for (int bit = 0; bit < 64; ++bit)
+            {
+                if ((polynomial & (1ULL << bit)) != 0)
+                    for (int index = 0; index < 4; ++index)
+                        jumpedState[index] ^= state[index];
+
+                (*this)();
+            }
+
+        for (int index = 0; index < 4; ++index)
+            state[index] = jumpedState[index];
+    }
+
+private:
+    uint64_t state[4];
+
+    static uint64_t RotateLeft(uint64_t value, int count)
+    {
+        return (value << count) | (value >> (64 - count));
+    }
+};
+
+// One call to the system's entropy source, for callers that want a different image on every run.
+inline uint64_t CreateRandomSeed()
+{
+    std::random_device randomDevice;
+
+    return ((uint64_t)randomDevice() << 32) ^ randomDevice();
+}
+
+// Each thread draws from its own engine, seeded once, for code that has no engine handed to it.
+inline RandomEngine& GetThreadRandomEngine()
+{
+    thread_local RandomEngine randomEngine(CreateRandomSeed());
+
+    return randomEngine;
+}
\ No newline at end of file
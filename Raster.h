@@ -0,0 +1,676 @@
+#pragma once
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+    #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cinttypes>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Random.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#ifndef SAFE_DELETE
+    #define SAFE_DELETE(pointer) { if (pointer != nullptr) delete[] pointer; pointer = nullptr; }
+#endif
+
+#ifndef CHECK_COORD_VALIDITY
+    #define CHECK_COORD_VALIDITY(x, y, width, height) (x >= 0 && y >= 0 && x < width && y < height)
+#endif
+
+#ifndef SWAP
+    #define SWAP(value1, value2, temp) { temp = value1; value1 = value2; value2 = temp; }
+#endif
+
+#ifndef EXECUTION_CONDITION
+    #define EXECUTION_CONDITION(expression, status) { if ((expression) == false) return (status); }
+#endif
+
+typedef uint8_t byte_t;
+typedef int32_t coord_t;
+
+enum class CLIPPING
+{
+    OUTSIDE = 0,
+    INSIDE  = 1,
+    PARTIAL = 2
+};
+
+enum class LINETYPE
+{
+    SOLID  = 0,
+    DASHED = 1,
+    DOTTED = 2
+};
+
+enum class LINEMODE
+{
+    ALIASED     = 0,
+    ANTIALIASED = 1
+};
+
+template <typename TYPE>
+struct Point
+{
+    TYPE x;
+    TYPE y;
+};
+
+template <typename TYPE>
+struct Size
+{
+    TYPE cx;
+    TYPE cy;
+};
+
+template <typename TYPE>
+struct Rect
+{
+    TYPE left;
+    TYPE top;
+    TYPE right;
+    TYPE bottom;
+};
+
+template <typename TYPE>
+struct Color
+{
+    TYPE red;
+    TYPE green;
+    TYPE blue;
+};
+
+typedef Point<coord_t>     PixelPoint;
+typedef Size<coord_t>      PixelSize;
+typedef Rect<coord_t>      PixelRectangle;
+typedef Color<byte_t>      PixelColor;
+
+struct PXMINFOHEADER
+{
+    std::string magicNumber;
+    size_t      width;
+    size_t      height;
+    byte_t      maxLevel;
+};
+
+// Mixes level towards color by alpha / 255, rounded, without a divide.
+inline byte_t BlendLevel(byte_t level, byte_t color, int alpha)
+{
+    int mixture = level * (255 - alpha) + color * alpha + 128;
+
+    return (byte_t)((mixture + (mixture >> 8)) >> 8);
+}
+
+// Pixel formats are compile-time tags, so the channel layout is resolved per format instead of branched on.
+struct Gray8
+{
+    typedef byte_t ColorType;
+
+    static const int CHANNEL_COUNT = 1;
+
+    static const char* GetMagicNumber(bool isBinary)
+    {
+        return (isBinary == true) ? ("P5") : ("P2");
+    }
+
+    static ColorType CreateGray(byte_t level)
+    {
+        return level;
+    }
+
+    static void Store(byte_t* pixel, ColorType color)
+    {
+        pixel[0] = color;
+    }
+
+    static void Blend(byte_t* pixel, ColorType color, int alpha)
+    {
+        pixel[0] = BlendLevel(pixel[0], color, alpha);
+    }
+
+    static void Fill(byte_t* pixel, size_t count, ColorType color)
+    {
+        memset(pixel, color, count);
+    }
+};
+
+struct RGB8
+{
+    typedef PixelColor ColorType;
+
+    static const int CHANNEL_COUNT = 3;
+
+    static const char* GetMagicNumber(bool isBinary)
+    {
+        return (isBinary == true) ? ("P6") : ("P3");
+    }
+
+    static ColorType CreateGray(byte_t level)
+    {
+        return { level, level, level };
+    }
+
+    static void Store(byte_t* pixel, ColorType color)
+    {
+        pixel[0] = color.red;
+        pixel[1] = color.green;
+        pixel[2] = color.blue;
+    }
+
+    // BlendLevel in three 16-bit lanes of one word; no lane reaches 65536, so none carries into the next.
+    static void Blend(byte_t* pixel, ColorType color, int alpha)
+    {
+        uint64_t levels  = (uint64_t)pixel[0] | ((uint64_t)pixel[1] << 16) | ((uint64_t)pixel[2] << 32);
+        uint64_t colors  = (uint64_t)color.red | ((uint64_t)color.green << 16) | ((uint64_t)color.blue << 32);
+        uint64_t mixture = levels * (uint64_t)(255 - alpha) + colors * (uint64_t)alpha + 0x0000008000800080ULL;
+
+        mixture  = ((mixture + ((mixture >> 8) & 0x000000FF00FF00FFULL)) >> 8) & 0x000000FF00FF00FFULL;
+        pixel[0] = (byte_t)mixture;
+        pixel[1] = (byte_t)(mixture >> 16);
+        pixel[2] = (byte_t)(mixture >> 32);
+    }
+
+    // Grey runs are one memset; other colours double the filled part with each memcpy.
+    static void Fill(byte_t* pixel, size_t count, ColorType color)
+    {
+        size_t byteCount   = count * CHANNEL_COUNT;
+        size_t filledCount = CHANNEL_COUNT;
+
+        if (color.red == color.green && color.green == color.blue)
+        {
+            memset(pixel, color.red, byteCount);
+            return;
+        }
+
+        if (count == 0)
+            return;
+
+        Store(pixel, color);
+
+        for (; filledCount < byteCount; filledCount *= 2)
+            memcpy(pixel + filledCount, pixel, std::min(filledCount, byteCount - filledCount));
+    }
+};
+
+template <typename FORMAT>
+class Framebuffer
+{
+public:
+    typedef typename FORMAT::ColorType ColorType;
+
+    Framebuffer() : width(0), height(0), stride(0), externalPixels(nullptr)
+    {
+    }
+
+    Framebuffer(coord_t width, coord_t height) : externalPixels(nullptr)
+    {
+        Resize(width, height);
+    }
+
+    // Keeps the allocation when the new image fits in it, so framebuffers can be reused from image to image.
+    void Resize(coord_t width, coord_t height)
+    {
+        this->width  = width;
+        this->height = height;
+        this->stride = (size_t)width * FORMAT::CHANNEL_COUNT;
+
+        externalPixels = nullptr;
+        pixels.resize(stride * height);
+    }
+
+    // Draws into memory the framebuffer does not own, such as a mapped file, until the next Resize.
+    void Attach(byte_t* pixelData, coord_t width, coord_t height)
+    {
+        Attach(pixelData, width, height, (size_t)width * FORMAT::CHANNEL_COUNT);
+    }
+
+    // Rows stride bytes apart let the framebuffer be a window into a larger image, such as one tile of it.
+    void Attach(byte_t* pixelData, coord_t width, coord_t height, size_t stride)
+    {
+        this->width  = width;
+        this->height = height;
+        this->stride = stride;
+
+        externalPixels = pixelData;
+    }
+
+    void Clear(ColorType color)
+    {
+        for (coord_t x = 0; x < width; ++x)
+            FORMAT::Store(GetData() + (size_t)x * FORMAT::CHANNEL_COUNT, color);
+
+        for (coord_t y = 1; y < height; ++y)
+            memcpy(GetData() + y * stride, GetData(), (size_t)width * FORMAT::CHANNEL_COUNT);
+    }
+
+    coord_t GetWidth() const
+    {
+        return width;
+    }
+
+    coord_t GetHeight() const
+    {
+        return height;
+    }
+
+    size_t GetStride() const
+    {
+        return stride;
+    }
+
+    PixelSize GetSize() const
+    {
+        return { width, height };
+    }
+
+    size_t GetByteCount() const
+    {
+        return stride * height;
+    }
+
+    byte_t* GetData()
+    {
+        return (externalPixels != nullptr) ? (externalPixels) : (pixels.data());
+    }
+
+    const byte_t* GetData() const
+    {
+        return (externalPixels != nullptr) ? (externalPixels) : (pixels.data());
+    }
+
+    byte_t* GetPixel(coord_t x, coord_t y)
+    {
+        return GetData() + y * stride + (size_t)x * FORMAT::CHANNEL_COUNT;
+    }
+
+    // Byte distance between two pixels, for writers that walk the image by pointer instead of by coordinate.
+    ptrdiff_t GetOffset(coord_t x, coord_t y) const
+    {
+        return (ptrdiff_t)y * (ptrdiff_t)stride + (ptrdiff_t)x * FORMAT::CHANNEL_COUNT;
+    }
+
+private:
+    coord_t             width;
+    coord_t             height;
+    size_t              stride;
+    std::vector<byte_t> pixels;
+    byte_t*             externalPixels;
+};
+
+static const int         PXM_LINE_LENGTH = 70;
+
+static const bool        SOLID_LINE[8]  = { true, true, true, true, true, true, true, true };
+static const bool        DASHED_LINE[8] = { true, true, true, true, false, false, false, false };
+static const bool        DOTTED_LINE[8] = { true, false, true, false, true, false, true, false };
+static const bool* const LINE_STYLES[3] = { SOLID_LINE, DASHED_LINE, DOTTED_LINE };
+
+// The same styles as bitmasks, bit k set when pixel k of every 8 is drawn.
+static const byte_t      LINE_MASKS[3]  = { 0xFF, 0x0F, 0x55 };
+
+template <typename TYPE>
+inline TYPE CreateRandomIntegerValue(TYPE minValue, TYPE maxValue)
+{
+    return (TYPE)GetThreadRandomEngine().CreateInteger((int)minValue, (int)maxValue);
+}
+
+template <typename TYPE>
+inline TYPE CreateRandomRealValue(TYPE minValue, TYPE maxValue)
+{
+    return (TYPE)GetThreadRandomEngine().CreateReal(minValue, maxValue);
+}
+
+inline int FormatPXMHeader(char* text, size_t textSize, PXMINFOHEADER pxmInfoHeader)
+{
+    return snprintf(text, textSize, "%s\n%zu %zu\n%d\n", pxmInfoHeader.magicNumber.data(), pxmInfoHeader.width, pxmInfoHeader.height, pxmInfoHeader.maxLevel);
+}
+
+// Formats one sample of an ASCII P2/P3 file; going through printf for every value was what made those files slow to write.
+inline char* FormatLevel(char* text, byte_t level)
+{
+    if (level >= 100)
+        *text++ = (char)('0' + level / 100);
+
+    if (level >= 10)
+        *text++ = (char)('0' + level / 10 % 10);
+
+    *text++ = (char)('0' + level % 10);
+
+    return text;
+}
+
+// Writes a PXM file a band of rows at a time, as the rows become final.
+template <typename FORMAT>
+class PXMWriter
+{
+public:
+    PXMWriter() : fileStream(nullptr), width(0), height(0), writtenRowCount(0), isBinary(true)
+    {
+    }
+
+    ~PXMWriter()
+    {
+        Close();
+    }
+
+    bool Open(const char* filePath, coord_t width, coord_t height, bool isBinary = true)
+    {
+        char header[64];
+        int  headerLength = FormatPXMHeader(header, sizeof(header), { FORMAT::GetMagicNumber(isBinary), (size_t)width, (size_t)height, 255 });
+
+        Close();
+
+        fileStream = fopen(filePath, "wb");
+        EXECUTION_CONDITION(fileStream != nullptr, false);
+
+        this->width     = width;
+        this->height    = height;
+        this->isBinary  = isBinary;
+        writtenRowCount = 0;
+
+        return fwrite(header, 1, headerLength, fileStream) == (size_t)headerLength;
+    }
+
+    // Consecutive rows lie stride bytes apart in the caller's memory.
+    bool WriteRows(const byte_t* rows, coord_t rowCount, size_t stride)
+    {
+        size_t rowSize = (size_t)width * FORMAT::CHANNEL_COUNT;
+
+        EXECUTION_CONDITION(fileStream != nullptr && rowCount >= 0 && writtenRowCount + rowCount <= height, false);
+
+        if (isBinary == true && stride == rowSize)
+            EXECUTION_CONDITION(fwrite(rows, 1, rowSize * rowCount, fileStream) == rowSize * rowCount, false)
+        else
+        {
+            for (coord_t row = 0; row < rowCount; ++row)
+            {
+                if (isBinary == true)
+                    EXECUTION_CONDITION(fwrite(rows + row * stride, 1, rowSize, fileStream) == rowSize, false)
+                else
+                    EXECUTION_CONDITION(WriteTextRow(rows + row * stride, rowSize), false);
+            }
+        }
+
+        writtenRowCount += rowCount;
+
+        return true;
+    }
+
+    bool WriteRows(const Framebuffer<FORMAT>& framebuffer, coord_t firstRow, coord_t rowCount)
+    {
+        EXECUTION_CONDITION(framebuffer.GetWidth() == width && firstRow >= 0 && firstRow + rowCount <= framebuffer.GetHeight(), false);
+
+        return WriteRows(framebuffer.GetData() + firstRow * framebuffer.GetStride(), rowCount, framebuffer.GetStride());
+    }
+
+    // Fails if the file could not be flushed or holds fewer rows than its header promises.
+    bool Close()
+    {
+        bool isComplete = (writtenRowCount == height);
+
+        if (fileStream == nullptr)
+            return true;
+
+        isComplete = (fclose(fileStream) == 0) && isComplete;
+        fileStream = nullptr;
+
+        return isComplete;
+    }
+
+private:
+    FILE*             fileStream;
+    coord_t           width;
+    coord_t           height;
+    coord_t           writtenRowCount;
+    bool              isBinary;
+    std::vector<char> text;
+
+    bool WriteTextRow(const byte_t* row, size_t sampleCount)
+    {
+        char* lineStart;
+        char* cursor;
+
+        if (sampleCount == 0)
+            return true;
+
+        text.resize(sampleCount * 4);
+        lineStart = cursor = text.data();
+
+        // Every sample takes at most four characters with its separator; a separator becomes a line break near PXM_LINE_LENGTH.
+        for (size_t index = 0; index < sampleCount; ++index)
+        {
+            if (cursor - lineStart > PXM_LINE_LENGTH - 4)
+            {
+                cursor[-1] = '\n';
+                lineStart  = cursor;
+            }
+
+            cursor    = FormatLevel(cursor, row[index]);
+            *cursor++ = ' ';
+        }
+
+        cursor[-1] = '\n';
+
+        return fwrite(text.data(), 1, cursor - text.data(), fileStream) == (size_t)(cursor - text.data());
+    }
+};
+
+// A binary PXM file mapped into memory, drawn into through GetFramebuffer() and written back by the system.
+template <typename FORMAT>
+class MappedPXM
+{
+public:
+#if defined(_WIN32)
+    MappedPXM() : fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr), mappedData(nullptr), mappedSize(0)
+#else
+    MappedPXM() : fileDescriptor(-1), mappedData(nullptr), mappedSize(0)
+#endif
+    {
+    }
+
+    ~MappedPXM()
+    {
+        Close();
+    }
+
+    bool Open(const char* filePath, coord_t width, coord_t height)
+    {
+        char header[64];
+        int  headerLength = FormatPXMHeader(header, sizeof(header), { FORMAT::GetMagicNumber(true), (size_t)width, (size_t)height, 255 });
+
+        Close();
+
+        mappedSize = headerLength + (size_t)width * height * FORMAT::CHANNEL_COUNT;
+
+#if defined(_WIN32)
+        fileHandle = CreateFileA(filePath, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READWRITE, (DWORD)((unsigned long long)mappedSize >> 32), (DWORD)(mappedSize & 0xFFFFFFFF), nullptr);
+
+        if (mappingHandle != nullptr)
+            mappedData = (byte_t*)MapViewOfFile(mappingHandle, FILE_MAP_WRITE, 0, 0, mappedSize);
+#else
+        fileDescriptor = open(filePath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if (fileDescriptor >= 0 && ftruncate(fileDescriptor, (off_t)mappedSize) == 0)
+        {
+            mappedData = (byte_t*)mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+            mappedData = (mappedData == (byte_t*)MAP_FAILED) ? (nullptr) : (mappedData);
+        }
+#endif
+
+        if (mappedData == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        memcpy(mappedData, header, headerLength);
+        framebuffer.Attach(mappedData + headerLength, width, height);
+
+        return true;
+    }
+
+    Framebuffer<FORMAT>& GetFramebuffer()
+    {
+        return framebuffer;
+    }
+
+    bool Close()
+    {
+        bool isClosed = true;
+
+#if defined(_WIN32)
+        if (mappedData != nullptr)
+            isClosed = (UnmapViewOfFile(mappedData) != 0);
+
+        if (mappingHandle != nullptr)
+            CloseHandle(mappingHandle);
+
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            isClosed = (CloseHandle(fileHandle) != 0) && isClosed;
+
+        fileHandle    = INVALID_HANDLE_VALUE;
+        mappingHandle = nullptr;
+#else
+        if (mappedData != nullptr)
+            isClosed = (munmap(mappedData, mappedSize) == 0);
+
+        if (fileDescriptor >= 0)
+            isClosed = (close(fileDescriptor) == 0) && isClosed;
+
+        fileDescriptor = -1;
+#endif
+
+        mappedData  = nullptr;
+        mappedSize  = 0;
+        framebuffer = Framebuffer<FORMAT>();
+
+        return isClosed;
+    }
+
+private:
+#if defined(_WIN32)
+    HANDLE              fileHandle;
+    HANDLE              mappingHandle;
+#else
+    int                 fileDescriptor;
+#endif
+    byte_t*             mappedData;
+    size_t              mappedSize;
+    Framebuffer<FORMAT> framebuffer;
+};
+
+template <typename FORMAT>
+inline bool WritePXM(const char* filePath, const Framebuffer<FORMAT>& framebuffer, bool isBinary = true)
+{
+    PXMWriter<FORMAT> writer;
+
+    EXECUTION_CONDITION(writer.Open(filePath, framebuffer.GetWidth(), framebuffer.GetHeight(), isBinary), false);
+    EXECUTION_CONDITION(writer.WriteRows(framebuffer, 0, framebuffer.GetHeight()), false);
+
+    return writer.Close();
+}
+
+template <typename FORMAT>
+inline bool SetPixel(Framebuffer<FORMAT>& framebuffer, PixelPoint point, typename FORMAT::ColorType color)
+{
+    if (CHECK_COORD_VALIDITY(point.x, point.y, framebuffer.GetWidth(), framebuffer.GetHeight()) == false)
+        return false;
+
+    FORMAT::Store(framebuffer.GetPixel(point.x, point.y), color);
+
+    return true;
+}
+
+// Fills row y from left to right inclusive, clipped to the framebuffer.
+template <typename FORMAT>
+inline void FillSpan(Framebuffer<FORMAT>& framebuffer, coord_t y, coord_t left, coord_t right, typename FORMAT::ColorType color)
+{
+    if (y < 0 || y >= framebuffer.GetHeight())
+        return;
+
+    left  = std::max(left, 0);
+    right = std::min(right, framebuffer.GetWidth() - 1);
+
+    if (left <= right)
+        FORMAT::Fill(framebuffer.GetPixel(left, y), (size_t)(right - left + 1), color);
+}
+
+// Classifies an inclusive pixel box against the framebuffer, so a primitive decides once whether its pixels need checking.
+template <typename FORMAT>
+inline CLIPPING ClipBoundingBox(const Framebuffer<FORMAT>& framebuffer, PixelRectangle box)
+{
+    if (box.right < 0 || box.bottom < 0 || box.left >= framebuffer.GetWidth() || box.top >= framebuffer.GetHeight())
+        return CLIPPING::OUTSIDE;
+
+    if (box.left >= 0 && box.top >= 0 && box.right < framebuffer.GetWidth() && box.bottom < framebuffer.GetHeight())
+        return CLIPPING::INSIDE;
+
+    return CLIPPING::PARTIAL;
+}
+
+// One axis of Liang-Barsky: narrows [minParameter, maxParameter] to where start + parameter * delta stays within [minValue, maxValue].
+inline bool ClipParameter(double start, double delta, double minValue, double maxValue, double& minParameter, double& maxParameter)
+{
+    double enterParameter;
+    double leaveParameter;
+
+    if (delta == 0.0)
+        return start >= minValue && start <= maxValue && minParameter <= maxParameter;
+
+    enterParameter = (((delta > 0.0) ? (minValue) : (maxValue)) - start) / delta;
+    leaveParameter = (((delta > 0.0) ? (maxValue) : (minValue)) - start) / delta;
+    minParameter   = std::max(minParameter, enterParameter);
+    maxParameter   = std::min(maxParameter, leaveParameter);
+
+    return minParameter <= maxParameter;
+}
+
+// Runs taskFunction(worker, task) for every task on workerCount threads, the calling thread being worker 0.
+template <typename TASKFUNCTION>
+inline void RunParallelTasks(int taskCount, int workerCount, TASKFUNCTION taskFunction)
+{
+    std::atomic<int>         nextTask(0);
+    std::vector<std::thread> workers;
+
+    auto work = [&](int worker)
+    {
+        for (int task = nextTask++; task < taskCount; task = nextTask++)
+            taskFunction(worker, task);
+    };
+
+    for (int worker = 1; worker < workerCount; ++worker)
+        workers.emplace_back(work, worker);
+
+    work(0);
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
\ No newline at end of file
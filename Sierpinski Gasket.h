@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Iterated Function System.h"
+
+static const int CHAOS_GAME_BATCH_SIZE = 256;
+
+// Vertex choices are drawn CHAOS_GAME_BATCH_SIZE at a time; the same engine state always gives the same image.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawSierpinskiGasket(Framebuffer<FORMAT>& framebuffer, PixelPoint point1, PixelPoint point2, PixelPoint point3, int steps, typename FORMAT::ColorType color, RandomEngine& randomEngine)
+{
+    PixelPoint points[3] = { point1, point2, point3 };
+    int        indices[CHAOS_GAME_BATCH_SIZE];
+    int        batchSize;
+    PixelPoint centerPoint;
+
+    SetPixel(framebuffer, points[0], color);
+    SetPixel(framebuffer, points[1], color);
+    SetPixel(framebuffer, points[2], color);
+
+    centerPoint = points[randomEngine.CreateInteger(0, 2)];
+
+    for (int step = 0; step < steps; step += batchSize)
+    {
+        batchSize = std::min(CHAOS_GAME_BATCH_SIZE, steps - step);
+        randomEngine.CreateIntegers(indices, batchSize, 0, 2);
+
+        for (int index = 0; index < batchSize; ++index)
+        {
+            centerPoint.x = (coord_t)((centerPoint.x + points[indices[index]].x) / 2.0 + 0.5);
+            centerPoint.y = (coord_t)((centerPoint.y + points[indices[index]].y) / 2.0 + 0.5);
+
+            SetPixel(framebuffer, centerPoint, color);
+        }
+    }
+
+    return framebuffer;
+}
+
+// Counts every point of one walk that lands inside the image, starting from a random vertex as the serial gasket does.
+inline void RunChaosGameWalk(uint32_t* hitCounts, PixelSize imageSize, const PixelPoint points[3], long long steps, RandomEngine& randomEngine)
+{
+    int        indices[CHAOS_GAME_BATCH_SIZE];
+    int        batchSize;
+    PixelPoint centerPoint = points[randomEngine.CreateInteger(0, 2)];
+
+    for (long long step = 0; step < steps; step += batchSize)
+    {
+        batchSize = (int)std::min((long long)CHAOS_GAME_BATCH_SIZE, steps - step);
+        randomEngine.CreateIntegers(indices, batchSize, 0, 2);
+
+        for (int index = 0; index < batchSize; ++index)
+        {
+            centerPoint.x = (coord_t)((centerPoint.x + points[indices[index]].x) / 2.0 + 0.5);
+            centerPoint.y = (coord_t)((centerPoint.y + points[indices[index]].y) / 2.0 + 0.5);
+
+            if (CHECK_COORD_VALIDITY(centerPoint.x, centerPoint.y, imageSize.cx, imageSize.cy) == true)
+                hitCounts[(size_t)centerPoint.y * imageSize.cx + centerPoint.x] += 1;
+        }
+    }
+}
+
+// Walk n draws from the seed's engine jumped n times, so the counts depend on the seed alone and not on the thread count.
+inline std::vector<uint32_t>& ComputeChaosGameHits(std::vector<uint32_t>& hitCounts, PixelSize imageSize, PixelPoint point1, PixelPoint point2, PixelPoint point3, long long steps, uint64_t seed, int threadCount)
+{
+    PixelPoint                points[3] = { point1, point2, point3 };
+    std::vector<RandomEngine> randomEngines;
+    RandomEngine              randomEngine(seed);
+
+    for (int walk = 0; walk < CHAOS_GAME_WALK_COUNT; ++walk)
+    {
+        randomEngines.push_back(randomEngine);
+        randomEngine.Jump();
+    }
+
+    return AccumulateHits(hitCounts, (size_t)imageSize.cx * imageSize.cy, CHAOS_GAME_WALK_COUNT, threadCount, [&](uint32_t* workerHitCounts, int walk)
+    {
+        RunChaosGameWalk(workerHitCounts, imageSize, points, steps / CHAOS_GAME_WALK_COUNT + ((walk < steps % CHAOS_GAME_WALK_COUNT) ? (1) : (0)), randomEngines[walk]);
+    });
+}
+
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawSierpinskiGasketDensity(Framebuffer<FORMAT>& framebuffer, PixelPoint point1, PixelPoint point2, PixelPoint point3, long long steps, typename FORMAT::ColorType color, uint64_t seed, int threadCount)
+{
+    std::vector<uint32_t> hitCounts;
+
+    ComputeChaosGameHits(hitCounts, framebuffer.GetSize(), point1, point2, point3, steps, seed, threadCount);
+
+    return ToneMapHitCounts(framebuffer, hitCounts.data(), color);
+}
\ No newline at end of file
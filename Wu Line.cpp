@@ -0,0 +1,18 @@
+#include "Wu Line.h"
+
+static const coord_t IMAGE_WIDTH  = 500;
+static const coord_t IMAGE_HEIGHT = 500;
+
+int main(void)
+{
+    Framebuffer<RGB8> image(IMAGE_WIDTH, IMAGE_HEIGHT);
+
+    image.Clear({ 255, 255, 255 });
+
+    DrawWuLine(image, { 50, 50 },   { 250, 250 }, { 0, 0, 0 },   LINETYPE::SOLID);
+    DrawWuLine(image, { 400, 300 }, { 0, 0 },     { 255, 0, 0 }, LINETYPE::SOLID);
+    DrawWuLine(image, { 200, 100 }, { 250, 250 }, { 0, 255, 0 }, LINETYPE::DASHED);
+    DrawWuLine(image, { 475, 475 }, { 125, 250 }, { 0, 0, 255 }, LINETYPE::DOTTED);
+
+    return (WritePXM("Wu Line.ppm", image) == true) ? (0) : (1);
+}
\ No newline at end of file
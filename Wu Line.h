@@ -0,0 +1,115 @@
+#pragma once
+
+#include "DDA Line.h"
+
+// The minor coordinate in 32.32 fixed point, its step rounded up so the whole part is exact below 65536 pixels.
+static const int WU_FRACTION_BITS = 32;
+
+// Blends a pixel that may lie outside the framebuffer.
+template <typename FORMAT>
+inline void BlendCheckedPixel(Framebuffer<FORMAT>& framebuffer, coord_t x, coord_t y, typename FORMAT::ColorType color, int alpha)
+{
+    if (alpha != 0 && CHECK_COORD_VALIDITY(x, y, framebuffer.GetWidth(), framebuffer.GetHeight()) == true)
+        FORMAT::Blend(framebuffer.GetPixel(x, y), color, alpha);
+}
+
+// Xiaolin Wu's line: each major step blends color into the two pixels the line passes between.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawWuLine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINETYPE lineType = LINETYPE::SOLID)
+{
+    PixelSize variation      = { endPoint.x - startPoint.x, endPoint.y - startPoint.y };
+    bool      isMajorX       = abs(variation.cx) >= abs(variation.cy);
+    coord_t   majorLength    = (isMajorX == true) ? (abs(variation.cx)) : (abs(variation.cy));
+    coord_t   minorLength    = (isMajorX == true) ? (abs(variation.cy)) : (abs(variation.cx));
+    int       majorDirection = (((isMajorX == true) ? (variation.cx) : (variation.cy)) < 0) ? (-1) : (1);
+    int       minorDirection = (((isMajorX == true) ? (variation.cy) : (variation.cx)) < 0) ? (-1) : (1);
+    double    firstParameter = 0.0;
+    double    lastParameter  = (double)majorLength;
+    byte_t    mask           = LINE_MASKS[(int)lineType];
+    uint64_t  fractionStep;
+    uint64_t  position;
+    long long firstIndex;
+    long long lastIndex;
+    coord_t   minor;
+    int       alpha;
+    uint32_t  fraction;
+    ptrdiff_t majorStep;
+    ptrdiff_t minorStep;
+    byte_t*   pixel;
+
+    if (majorLength == 0)
+    {
+        if ((mask & 1) != 0)
+            SetPixel(framebuffer, startPoint, color);
+
+        return framebuffer;
+    }
+
+    // Both pixels of a step may be touched, so the range is clipped one pixel wider on each side.
+    EXECUTION_CONDITION(ClipParameter(startPoint.x, (double)variation.cx / majorLength, -1.0, framebuffer.GetWidth(),  firstParameter, lastParameter), framebuffer);
+    EXECUTION_CONDITION(ClipParameter(startPoint.y, (double)variation.cy / majorLength, -1.0, framebuffer.GetHeight(), firstParameter, lastParameter), framebuffer);
+
+    firstIndex   = std::max(0LL, (long long)floor(firstParameter) - 1);
+    lastIndex    = std::min((long long)majorLength, (long long)ceil(lastParameter) + 1);
+    fractionStep = (((uint64_t)minorLength << WU_FRACTION_BITS) + majorLength - 1) / majorLength;
+    position     = firstIndex * fractionStep;
+
+    // Inside the framebuffer a pixel pointer walks the line, the fraction's 32-bit carry being the extra minor step.
+    if (ClipBoundingBox(framebuffer, { std::min(startPoint.x, endPoint.x) - 1, std::min(startPoint.y, endPoint.y) - 1, std::max(startPoint.x, endPoint.x) + 1, std::max(startPoint.y, endPoint.y) + 1 }) == CLIPPING::INSIDE)
+    {
+        majorStep = (isMajorX == true) ? (framebuffer.GetOffset(majorDirection, 0)) : (framebuffer.GetOffset(0, majorDirection));
+        minorStep = (isMajorX == true) ? (framebuffer.GetOffset(0, minorDirection)) : (framebuffer.GetOffset(minorDirection, 0));
+        pixel     = framebuffer.GetPixel(startPoint.x, startPoint.y);
+        fraction  = 0;
+
+        for (long long index = 0; index <= majorLength; ++index)
+        {
+            alpha = (int)(fraction >> 24);
+
+            if (((mask >> (index & 7)) & 1) != 0)
+            {
+                FORMAT::Blend(pixel, color, 255 - alpha);
+
+                if (alpha != 0)
+                    FORMAT::Blend(pixel + minorStep, color, alpha);
+            }
+
+            fraction += (uint32_t)fractionStep;
+            pixel    += majorStep + (ptrdiff_t)((fractionStep >> WU_FRACTION_BITS) + (fraction < (uint32_t)fractionStep)) * minorStep;
+        }
+
+        return framebuffer;
+    }
+
+    for (long long index = firstIndex; index <= lastIndex; ++index, position += fractionStep)
+    {
+        if (((mask >> (index & 7)) & 1) == 0)
+            continue;
+
+        minor = (coord_t)(position >> WU_FRACTION_BITS) * minorDirection;
+        alpha = (int)(position >> (WU_FRACTION_BITS - 8)) & 0xFF;
+
+        if (isMajorX == true)
+        {
+            BlendCheckedPixel(framebuffer, startPoint.x + majorDirection * (coord_t)index, startPoint.y + minor, color, 255 - alpha);
+            BlendCheckedPixel(framebuffer, startPoint.x + majorDirection * (coord_t)index, startPoint.y + minor + minorDirection, color, alpha);
+        }
+        else
+        {
+            BlendCheckedPixel(framebuffer, startPoint.x + minor, startPoint.y + majorDirection * (coord_t)index, color, 255 - alpha);
+            BlendCheckedPixel(framebuffer, startPoint.x + minor + minorDirection, startPoint.y + majorDirection * (coord_t)index, color, alpha);
+        }
+    }
+
+    return framebuffer;
+}
+
+// The solid line of the curve and tree generators: the exact DDA, or Wu's coverage for LINEMODE::ANTIALIASED.
+template <typename FORMAT>
+inline Framebuffer<FORMAT>& DrawLine(Framebuffer<FORMAT>& framebuffer, PixelPoint startPoint, PixelPoint endPoint, typename FORMAT::ColorType color, LINEMODE lineMode)
+{
+    if (lineMode == LINEMODE::ANTIALIASED)
+        return DrawWuLine(framebuffer, startPoint, endPoint, color);
+
+    return DrawDDALine(framebuffer, startPoint, endPoint, color);
+}
\ No newline at end of file